@@ -0,0 +1,34 @@
+/**
+ * @file    lowpower.h
+ * @brief   Tickless idle on TIM2 and wake-up / sleep residency counters
+ * @author  Generated for RTOS version
+ */
+
+#ifndef __LOWPOWER_H
+#define __LOWPOWER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants */
+/* Registers of the low-power block, in Modbus order (after the task statistics) */
+#define LOWPOWER_REG_WAKEUPS 0   // Exits from sleep per second over the last window
+#define LOWPOWER_REG_TICKS 1     // Kernel tick interrupts per second over the last window
+#define LOWPOWER_REG_RESIDENCY 2 // Time spent asleep over the last window (% x 100)
+#define LOWPOWER_REG_COUNT 3
+
+    /* Exported functions */
+    void LowPower_CountTick(void);
+    void LowPower_Sample(uint32_t window_ms);
+    uint16_t LowPower_ReadRegister(uint8_t reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOWPOWER_H */
@@ -12,13 +12,10 @@ extern "C"
 {
 #endif
 
-/* Modbus configuration */
+/* stModbus configuration (shared engine in stModbus/, FreeRTOS port) */
 #define STMODBUS_COUNT_CONTEXT 1
-#define STMODBUS_USE_CRITICAL_SECTIONS 1
-
-/* Critical section macros for FreeRTOS */
-#define stmbEnterCriticalSection taskENTER_CRITICAL
-#define stmbLeaveCriticalSection taskEXIT_CRITICAL
+#define STMODBUS_COUNT_FUNC 0
+#define STMODBUS_USE_CRITICAL_SECTIONS 1 // Kernel critical sections from the port
 
 /* Modbus RTU configuration */
 #define MODBUS_SLAVE_ADDRESS 0x01
@@ -28,9 +25,11 @@ extern "C"
 /* UART buffer sizes */
 #define MODBUS_RX_BUFFER_SIZE 256
 #define MODBUS_TX_BUFFER_SIZE 256
+#define STMODBUS_MAX_FRAME_SIZE MODBUS_RX_BUFFER_SIZE
+#define STMODBUS_QUEUE_SIZE (2 * (MODBUS_RX_BUFFER_SIZE + 4)) // ISR -> task frame queue, two frames with length headers
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* __MODBUS_CONF_H */
\ No newline at end of file
+#endif /* __MODBUS_CONF_H */
@@ -14,11 +14,26 @@ extern "C"
 
 #include <stdint.h>
 #include "modbus_conf.h"
+#include "task_stats.h"
+#include "lowpower.h"
+
+/* Register map */
+#define MODBUS_INPUT_REG_BASE 30001 // Input registers (FC04) - read-only RTOS statistics
+#define MODBUS_INPUT_REG_LOWPOWER (TASK_STATS_REG_COUNT) // 30017: low-power block after the task statistics
+#define MODBUS_INPUT_REG_COUNT (TASK_STATS_REG_COUNT + LOWPOWER_REG_COUNT)
 
     /* Exported variables */
     extern uint16_t device_registers[MODBUS_DEVICE_REGISTERS];
+    extern uint16_t input_registers[MODBUS_INPUT_REG_COUNT];
 
     /* Exported functions */
+    void Modbus_Device_Init(void);
+    void Modbus_Device_Lock(void);
+    void Modbus_Device_Unlock(void);
+    void Modbus_Device_UpdateMQ2(void);
+    void Modbus_Device_UpdateSCD30(void);
+    void Modbus_Device_UpdateUptime(void);
+    void Modbus_Device_UpdateStats(void);
     uint16_t Modbus_Device_Read(uint32_t logical_address);
     uint16_t Modbus_Device_Write(uint32_t logical_address, uint16_t value);
     void Modbus_Device_SetRegister(uint8_t index, uint16_t value);
@@ -21,6 +21,8 @@ extern "C"
     /* Exported functions */
     void Modbus_Init(void);
     void Modbus_Process(void);
+    void Modbus_ReceiveFromISR(const uint8_t *data, uint16_t size);
+    void Modbus_TransmitCompleteFromISR(void);
     mbus_t Modbus_GetContext(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,81 @@
+/**
+ * @file    ram_budget.h
+ * @brief   Static RAM budget: task stacks, buffers, register banks and kernel objects
+ * @author  Generated for RTOS version
+ *
+ * Every kernel object is allocated statically (no FreeRTOS heap), so the
+ * RAM map is fixed at build time. The figures below are the budget; the
+ * application sizes its stacks from them, and ram_budget.c prints them as
+ * a table while compiling, checks them against the real definitions and
+ * fails the build if a region is over budget. The linker still checks the
+ * complete image against the memory regions.
+ */
+
+#ifndef __RAM_BUDGET_H
+#define __RAM_BUDGET_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Exported constants */
+/* Memory regions of the STM32F303K8 (bytes) */
+#define RAM_SRAM_SIZE 12288
+#define RAM_CCM_SIZE 4096
+
+/* CCM-RAM: application task stacks. DMA cannot reach CCM-RAM on this part,
+ * so only stacks go there (no DMA transfer ever targets a stack buffer). */
+#define RAM_STACK_DEFAULT_TASK 512
+#define RAM_STACK_MODBUS_TASK 1024
+#define RAM_STACK_MQ2_TASK 512
+#define RAM_STACK_SCD30_TASK 512
+
+/* SRAM: kernel and interrupt stacks */
+#define RAM_STACK_IDLE_TASK 512   // configMINIMAL_STACK_SIZE words
+#define RAM_STACK_TIMER_TASK 1024 // configTIMER_TASK_STACK_DEPTH words
+#define RAM_STACK_MAIN 1024       // _Min_Stack_Size in the linker script (ISRs)
+
+/* SRAM: buffers */
+#define RAM_BUF_MODBUS_RX 256    // UART RX DMA
+#define RAM_BUF_MODBUS_TX 256    // UART TX DMA
+#define RAM_BUF_MODBUS_FRAME 256 // Frame being parsed by the Modbus task
+#define RAM_BUF_MODBUS_QUEUE 521 // ISR -> task message buffer storage
+#define RAM_BUF_ADC_SCAN 12      // MQ2 ADC DMA scan
+#define RAM_BUF_LIBC_HEAP 512    // _Min_Heap_Size in the linker script (newlib)
+#define RAM_BUF_TASK_STATS 216   // Task status snapshot for the statistics window
+
+/* SRAM: register banks */
+#define RAM_REG_HOLDING 40 // 40001-40020
+#define RAM_REG_INPUT 38   // 30001-30019
+
+/* SRAM: kernel objects */
+#define RAM_KERNEL_TCB 1032         // 6 task control blocks (4 tasks, idle, timer)
+#define RAM_KERNEL_READY_LISTS 1120 // One list per priority (configMAX_PRIORITIES)
+#define RAM_KERNEL_SYNC 144         // Register lock, sensor events, RX message buffer
+
+/* SRAM not itemised above: HAL handles, driver and sensor state, the rest
+ * of the kernel (delay lists, timer queue, registry) and libc data */
+#define RAM_RESERVE_OTHER 2560
+
+/* Budgets per region */
+#define RAM_CCM_USED (RAM_STACK_DEFAULT_TASK + RAM_STACK_MODBUS_TASK + \
+                      RAM_STACK_MQ2_TASK + RAM_STACK_SCD30_TASK)
+
+#define RAM_SRAM_USED (RAM_STACK_IDLE_TASK + RAM_STACK_TIMER_TASK + RAM_STACK_MAIN +         \
+                       RAM_BUF_MODBUS_RX + RAM_BUF_MODBUS_TX + RAM_BUF_MODBUS_FRAME +        \
+                       RAM_BUF_MODBUS_QUEUE + RAM_BUF_ADC_SCAN + RAM_BUF_LIBC_HEAP +         \
+                       RAM_BUF_TASK_STATS +                                                  \
+                       RAM_REG_HOLDING + RAM_REG_INPUT +                                     \
+                       RAM_KERNEL_TCB + RAM_KERNEL_READY_LISTS + RAM_KERNEL_SYNC +           \
+                       RAM_RESERVE_OTHER)
+
+/* Exported macros */
+/* Place a buffer in CCM-RAM; the section is neither loaded nor zeroed */
+#define RAM_CCM_NOINIT __attribute__((section(".ccm_noinit")))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RAM_BUDGET_H */
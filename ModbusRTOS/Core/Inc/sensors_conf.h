@@ -0,0 +1,15 @@
+/**
+ * @file    sensors_conf.h
+ * @brief   stSensors configuration for ModbusRTOS
+ * @author  Generated for RTOS version
+ */
+
+#ifndef __SENSORS_CONF_H
+#define __SENSORS_CONF_H
+
+/* Exported constants --------------------------------------------------------*/
+#define SENSORS_USE_BURST 0 // No MQ2 burst capture in this build
+
+/* Trace and bring-up hooks keep their no-op defaults (sensors.h) */
+
+#endif /* __SENSORS_CONF_H */
@@ -0,0 +1,45 @@
+/**
+ * @file    task_stats.h
+ * @brief   Task CPU load, stack headroom and USART1 interrupt latency
+ * @author  Generated for RTOS version
+ */
+
+#ifndef __TASK_STATS_H
+#define __TASK_STATS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants */
+#define TASK_STATS_MAX_TASKS 6     // 4 application tasks, idle, timer service
+#define TASK_STATS_WINDOW_MS 5000  // CPU load averaging window
+#define TASK_STATS_PROBE_TICKS 800021 // Latency probe period (~100 ms at 8 MHz, not a multiple of the 1 ms tick)
+
+/* Registers of the statistics block, in Modbus order */
+#define TASK_STATS_REG_CPU_LOAD 0       // CPU load over the last window (% x 100)
+#define TASK_STATS_REG_LATENCY_MAX 1    // USART1 interrupt latency, max since boot (TIM2 ticks)
+#define TASK_STATS_REG_LATENCY_WINDOW 2 // USART1 interrupt latency, max over the last window (TIM2 ticks)
+#define TASK_STATS_REG_WINDOW_MS 3      // Length of the last window (ms)
+#define TASK_STATS_REG_TASKS 4          // Per task, in creation order: load (% x 100), stack headroom (bytes)
+#define TASK_STATS_REG_COUNT (TASK_STATS_REG_TASKS + 2 * TASK_STATS_MAX_TASKS)
+
+    /* Exported variables */
+    extern TIM_HandleTypeDef htim2;
+
+    /* Exported functions */
+    void TaskStats_StartTimer(void);
+    uint32_t TaskStats_GetCounter(void);
+    void TaskStats_Usart1IrqEntry(void);
+    uint8_t TaskStats_Sample(void);
+    uint16_t TaskStats_ReadRegister(uint8_t reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TASK_STATS_H */
@@ -0,0 +1,190 @@
+/**
+ * @file    lowpower.c
+ * @brief   Tickless idle on TIM2 and wake-up / sleep residency counters
+ * @author  Generated for RTOS version
+ *
+ * With configUSE_TICKLESS_IDLE, the idle task stops the 1 ms SysTick and
+ * sleeps (WFI) until the next kernel deadline: a sensor period, the
+ * publisher timeout or a blocked task's timeout. The wake-up time is a
+ * TIM2 channel 2 compare. TIM2 already runs free at the core clock for the
+ * run-time stats and keeps counting while the core sleeps, so the sleep is
+ * measured exactly and the kernel tick does not drift, unlike the SysTick
+ * based default of the port. Its 32 bits also allow far longer sleeps than
+ * the 24-bit SysTick.
+ *
+ * Any other interrupt ends the sleep early; in practice that is USART1
+ * (idle line / RX DMA) when a Modbus frame arrives, the SCD30 RDY pin and
+ * the ADC DMA of a MQ2 scan. The core stays in Sleep mode, not Stop mode:
+ * USART1 and the DMA keep their clocks, so a frame at 9600 baud loses no
+ * byte and its reply is not delayed.
+ *
+ * The HAL time base (TIM6) is suspended while asleep. HAL_GetTick() follows
+ * the kernel tick once the scheduler runs, so HAL timeouts, health ages and
+ * the uptime register keep counting through the sleep.
+ */
+
+#include "lowpower.h"
+#include "cmsis_os.h"
+#include "task.h"
+#include "task_stats.h"
+
+/* Private defines */
+#define LOWPOWER_TICK_COUNTS (configCPU_CLOCK_HZ / configTICK_RATE_HZ) // TIM2 and SysTick counts per tick
+#define LOWPOWER_MAX_IDLE_TICKS ((UINT32_MAX / 2) / LOWPOWER_TICK_COUNTS)
+
+/* Private variables */
+static volatile uint32_t lowpower_wakeups;      // Exits from sleep since the last sample
+static volatile uint32_t lowpower_ticks;        // Tick interrupts since the last sample
+static volatile uint32_t lowpower_sleep_counts; // TIM2 counts spent asleep since the last sample
+
+static uint16_t lowpower_registers[LOWPOWER_REG_COUNT];
+
+/* Exported functions */
+
+/**
+ * @brief  HAL time base, kept in step with the kernel tick
+ * @param  None
+ * @retval Milliseconds (HAL tick before the scheduler starts, kernel tick after)
+ * @note   Overrides the weak HAL definition. TIM6 is suspended during
+ *         tickless sleep, so its count alone would fall behind.
+ */
+uint32_t HAL_GetTick(void)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+        return uwTick;
+    return osKernelGetTickCount();
+}
+
+#if (configUSE_TICKLESS_IDLE == 1)
+/**
+ * @brief  Sleep with the tick suppressed until the next kernel deadline (idle task)
+ * @param  xExpectedIdleTime: Ticks until the next task unblocks
+ * @retval None
+ * @note   Overrides the weak SysTick based version of the port. Runs with
+ *         the scheduler suspended; interrupts stay masked from before the
+ *         sleep until the kernel tick has been corrected, so the handler of
+ *         the wake-up interrupt already sees the right time.
+ */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+    if (xExpectedIdleTime > LOWPOWER_MAX_IDLE_TICKS)
+        xExpectedIdleTime = LOWPOWER_MAX_IDLE_TICKS;
+
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    // A task made ready by an interrupt since the idle task decided to sleep
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep)
+    {
+        __enable_irq();
+        return;
+    }
+
+    // Stop the tick; the counts left in the current period place the next
+    // tick boundary on the TIM2 time line
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uint32_t start = __HAL_TIM_GET_COUNTER(&htim2);
+    uint32_t to_boundary = SysTick->VAL;
+
+    __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_2, start + to_boundary + (xExpectedIdleTime - 1) * LOWPOWER_TICK_COUNTS);
+    __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_CC2);
+    __HAL_TIM_ENABLE_IT(&htim2, TIM_IT_CC2);
+    HAL_SuspendTick();
+
+    // A pending interrupt ends WFI even with interrupts masked
+    __DSB();
+    __WFI();
+    __ISB();
+
+    uint32_t elapsed = __HAL_TIM_GET_COUNTER(&htim2) - start;
+
+    HAL_ResumeTick();
+    __HAL_TIM_DISABLE_IT(&htim2, TIM_IT_CC2);
+    __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_CC2);
+
+    // Whole ticks slept, and what is left of the tick period in progress
+    uint32_t ticks;
+    uint32_t remaining;
+    if (elapsed < to_boundary)
+    {
+        ticks = 0;
+        remaining = to_boundary - elapsed;
+    }
+    else
+    {
+        uint32_t past = elapsed - to_boundary;
+        ticks = 1 + past / LOWPOWER_TICK_COUNTS;
+        remaining = LOWPOWER_TICK_COUNTS - past % LOWPOWER_TICK_COUNTS;
+    }
+
+    // The kernel may not step onto the deadline itself; the last tick is
+    // left to the tick interrupt, which unblocks the task that is due
+    if (ticks >= xExpectedIdleTime)
+    {
+        ticks = xExpectedIdleTime - 1;
+        SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+    }
+    vTaskStepTick(ticks);
+
+    // Restart the tick on its original phase
+    SysTick->LOAD = remaining - 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = LOWPOWER_TICK_COUNTS - 1;
+
+    lowpower_wakeups++;
+    lowpower_sleep_counts += elapsed;
+
+    __enable_irq();
+}
+#endif /* configUSE_TICKLESS_IDLE */
+
+/**
+ * @brief  Count one kernel tick interrupt (traceTASK_INCREMENT_TICK, SysTick ISR)
+ * @param  None
+ * @retval None
+ */
+void LowPower_CountTick(void)
+{
+    lowpower_ticks++;
+}
+
+/**
+ * @brief  Close a statistics window (publisher task, with the task statistics)
+ * @param  window_ms: Length of the window (ms)
+ * @retval None
+ */
+void LowPower_Sample(uint32_t window_ms)
+{
+    taskENTER_CRITICAL();
+    uint32_t wakeups = lowpower_wakeups;
+    uint32_t ticks = lowpower_ticks;
+    uint32_t sleep_counts = lowpower_sleep_counts;
+    lowpower_wakeups = 0;
+    lowpower_ticks = 0;
+    lowpower_sleep_counts = 0;
+    taskEXIT_CRITICAL();
+
+    if (window_ms == 0)
+        return;
+
+    uint64_t window_counts = (uint64_t)window_ms * (SystemCoreClock / 1000);
+
+    lowpower_registers[LOWPOWER_REG_WAKEUPS] = (uint16_t)((uint64_t)wakeups * 1000 / window_ms);
+    lowpower_registers[LOWPOWER_REG_TICKS] = (uint16_t)((uint64_t)ticks * 1000 / window_ms);
+    lowpower_registers[LOWPOWER_REG_RESIDENCY] =
+        (sleep_counts >= window_counts) ? 10000 : (uint16_t)((uint64_t)sleep_counts * 10000 / window_counts);
+}
+
+/**
+ * @brief  Read one register of the low-power block
+ * @param  reg: Register (LOWPOWER_REG_*)
+ * @retval Value from the last closed window
+ */
+uint16_t LowPower_ReadRegister(uint8_t reg)
+{
+    if (reg < LOWPOWER_REG_COUNT)
+        return lowpower_registers[reg];
+    return 0;
+}
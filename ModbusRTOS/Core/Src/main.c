@@ -25,18 +25,26 @@
 #include "modbus.h"
 #include "modbus_init.h"
 #include "modbus_device.h"
-#include "modbus_test.h"
+#include "ram_budget.h"
+#include "sensors.h"
 #include "uart_callbacks.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
+typedef StaticTask_t osStaticThreadDef_t;
+typedef StaticEventGroup_t osStaticEventGroupDef_t;
 /* USER CODE BEGIN PTD */
 
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+/* sensorEvents bits: new data waiting to be mapped to the registers */
+#define SENSOR_EVENT_MQ2 0x0001U
+#define SENSOR_EVENT_SCD30 0x0002U
 
+#define MQ2_UPDATE_PERIOD_MS 1000
+#define PUBLISH_TIMEOUT_MS 1000 // Uptime register refresh when no sensor reports
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -45,34 +53,78 @@
 /* USER CODE END PM */
 
 /* Private variables ---------------------------------------------------------*/
+ADC_HandleTypeDef hadc1;
+DMA_HandleTypeDef hdma_adc1;
+
+I2C_HandleTypeDef hi2c1;
+
+TIM_HandleTypeDef htim2;
+
 UART_HandleTypeDef huart1;
 DMA_HandleTypeDef hdma_usart1_rx;
 DMA_HandleTypeDef hdma_usart1_tx;
 
 /* Definitions for defaultTask */
 osThreadId_t defaultTaskHandle;
+uint32_t defaultTaskBuffer[RAM_STACK_DEFAULT_TASK / sizeof(uint32_t)] RAM_CCM_NOINIT;
+osStaticThreadDef_t defaultTaskControlBlock;
 const osThreadAttr_t defaultTask_attributes = {
     .name = "defaultTask",
-    .stack_size = 128 * 4,
+    .cb_mem = &defaultTaskControlBlock,
+    .cb_size = sizeof(defaultTaskControlBlock),
+    .stack_mem = &defaultTaskBuffer[0],
+    .stack_size = sizeof(defaultTaskBuffer),
     .priority = (osPriority_t)osPriorityNormal,
 };
 
 /* Definitions for Modbus_Communication_Task */
 osThreadId_t ModbusCommunicationTaskHandle;
+uint32_t ModbusCommunicationTaskBuffer[RAM_STACK_MODBUS_TASK / sizeof(uint32_t)] RAM_CCM_NOINIT;
+osStaticThreadDef_t ModbusCommunicationTaskControlBlock;
 const osThreadAttr_t ModbusCommunicationTask_attributes = {
     .name = "ModbusComm",
-    .stack_size = 256 * 4,
-    .priority = (osPriority_t)osPriorityNormal,
+    .cb_mem = &ModbusCommunicationTaskControlBlock,
+    .cb_size = sizeof(ModbusCommunicationTaskControlBlock),
+    .stack_mem = &ModbusCommunicationTaskBuffer[0],
+    .stack_size = sizeof(ModbusCommunicationTaskBuffer),
+    .priority = (osPriority_t)osPriorityAboveNormal,
 };
 
-/* Definitions for Sensor_Update_Task */
-osThreadId_t SensorUpdateTaskHandle;
-const osThreadAttr_t SensorUpdateTask_attributes = {
-    .name = "SensorUpdate",
-    .stack_size = 128 * 4,
+/* Definitions for MQ2_Update_Task */
+osThreadId_t MQ2UpdateTaskHandle;
+uint32_t MQ2UpdateTaskBuffer[RAM_STACK_MQ2_TASK / sizeof(uint32_t)] RAM_CCM_NOINIT;
+osStaticThreadDef_t MQ2UpdateTaskControlBlock;
+const osThreadAttr_t MQ2UpdateTask_attributes = {
+    .name = "MQ2Update",
+    .cb_mem = &MQ2UpdateTaskControlBlock,
+    .cb_size = sizeof(MQ2UpdateTaskControlBlock),
+    .stack_mem = &MQ2UpdateTaskBuffer[0],
+    .stack_size = sizeof(MQ2UpdateTaskBuffer),
     .priority = (osPriority_t)osPriorityBelowNormal,
 };
 
+/* Definitions for SCD30_Update_Task */
+osThreadId_t SCD30UpdateTaskHandle;
+uint32_t SCD30UpdateTaskBuffer[RAM_STACK_SCD30_TASK / sizeof(uint32_t)] RAM_CCM_NOINIT;
+osStaticThreadDef_t SCD30UpdateTaskControlBlock;
+const osThreadAttr_t SCD30UpdateTask_attributes = {
+    .name = "SCD30Update",
+    .cb_mem = &SCD30UpdateTaskControlBlock,
+    .cb_size = sizeof(SCD30UpdateTaskControlBlock),
+    .stack_mem = &SCD30UpdateTaskBuffer[0],
+    .stack_size = sizeof(SCD30UpdateTaskBuffer),
+    .priority = (osPriority_t)osPriorityLow,
+};
+
+/* Definitions for sensorEvents */
+osEventFlagsId_t sensorEventsHandle;
+osStaticEventGroupDef_t sensorEventsControlBlock;
+const osEventFlagsAttr_t sensorEvents_attributes = {
+    .name = "sensorEvents",
+    .cb_mem = &sensorEventsControlBlock,
+    .cb_size = sizeof(sensorEventsControlBlock),
+};
+
 /* USER CODE BEGIN PV */
 
 /* USER CODE END PV */
@@ -82,9 +134,13 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_DMA_Init(void);
 static void MX_USART1_UART_Init(void);
+static void MX_ADC1_Init(void);
+static void MX_I2C1_Init(void);
+static void MX_TIM2_Init(void);
 void StartDefaultTask(void *argument);
 void ModbusCommunicationTask(void *argument);
-void SensorUpdateTask(void *argument);
+void MQ2UpdateTask(void *argument);
+void SCD30UpdateTask(void *argument);
 extern void initialise_monitor_handles(void);
 
 /* USER CODE BEGIN PFP */
@@ -127,6 +183,9 @@ int main(void)
   MX_GPIO_Init();
   MX_DMA_Init();
   MX_USART1_UART_Init();
+  MX_ADC1_Init();
+  MX_I2C1_Init();
+  MX_TIM2_Init();
   /* USER CODE BEGIN 2 */
 
   // Initialize UART callbacks
@@ -135,8 +194,9 @@ int main(void)
   // Initialize Modbus RTU slave
   Modbus_Init();
 
-  // Initialize test functions
-  Modbus_Test_Init();
+  // Sensor state only; the sensor tasks bring up the ADC and the SCD30, and
+  // the sensors read as "initialising" until they have
+  Sensors_Init();
 
   /* USER CODE END 2 */
 
@@ -145,6 +205,10 @@ int main(void)
 
   /* USER CODE BEGIN RTOS_MUTEX */
   /* add mutexes, ... */
+
+  // Register bank lock shared by the Modbus task and the publisher
+  Modbus_Device_Init();
+
   /* USER CODE END RTOS_MUTEX */
 
   /* USER CODE BEGIN RTOS_SEMAPHORES */
@@ -169,11 +233,15 @@ int main(void)
   // Create Modbus communication task
   ModbusCommunicationTaskHandle = osThreadNew(ModbusCommunicationTask, NULL, &ModbusCommunicationTask_attributes);
 
-  // Create sensor update task
-  SensorUpdateTaskHandle = osThreadNew(SensorUpdateTask, NULL, &SensorUpdateTask_attributes);
+  // Create one task per sensor, each at the sensor's own rate
+  MQ2UpdateTaskHandle = osThreadNew(MQ2UpdateTask, NULL, &MQ2UpdateTask_attributes);
+  SCD30UpdateTaskHandle = osThreadNew(SCD30UpdateTask, NULL, &SCD30UpdateTask_attributes);
 
   /* USER CODE END RTOS_THREADS */
 
+  /* creation of sensorEvents */
+  sensorEventsHandle = osEventFlagsNew(&sensorEvents_attributes);
+
   /* USER CODE BEGIN RTOS_EVENTS */
   /* add events, ... */
   /* USER CODE END RTOS_EVENTS */
@@ -228,14 +296,216 @@ void SystemClock_Config(void)
   {
     Error_Handler();
   }
-  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART1;
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USART1 | RCC_PERIPHCLK_I2C1;
   PeriphClkInit.Usart1ClockSelection = RCC_USART1CLKSOURCE_PCLK1;
+  PeriphClkInit.I2c1ClockSelection = RCC_I2C1CLKSOURCE_HSI;
   if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
   {
     Error_Handler();
   }
 }
 
+/**
+ * @brief ADC1 Initialization Function
+ * @param None
+ * @retval None
+ */
+static void MX_ADC1_Init(void)
+{
+
+  /* USER CODE BEGIN ADC1_Init 0 */
+
+  /* USER CODE END ADC1_Init 0 */
+
+  ADC_MultiModeTypeDef multimode = {0};
+  ADC_ChannelConfTypeDef sConfig = {0};
+
+  /* USER CODE BEGIN ADC1_Init 1 */
+
+  /* USER CODE END ADC1_Init 1 */
+
+  /** Common config
+   */
+  hadc1.Instance = ADC1;
+  hadc1.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV1;
+  hadc1.Init.Resolution = ADC_RESOLUTION_12B;
+  hadc1.Init.ScanConvMode = ADC_SCAN_ENABLE;
+  hadc1.Init.ContinuousConvMode = DISABLE;
+  hadc1.Init.DiscontinuousConvMode = DISABLE;
+  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+  hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+  hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+  hadc1.Init.NbrOfConversion = 4;
+  hadc1.Init.DMAContinuousRequests = ENABLE;
+  hadc1.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+  hadc1.Init.LowPowerAutoWait = DISABLE;
+  hadc1.Init.Overrun = ADC_OVR_DATA_OVERWRITTEN;
+  if (HAL_ADC_Init(&hadc1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure the ADC multi-mode
+   */
+  multimode.Mode = ADC_MODE_INDEPENDENT;
+  if (HAL_ADCEx_MultiModeConfigChannel(&hadc1, &multimode) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+   */
+  sConfig.Channel = ADC_CHANNEL_1;
+  sConfig.Rank = ADC_REGULAR_RANK_1;
+  sConfig.SingleDiff = ADC_SINGLE_ENDED;
+  sConfig.SamplingTime = ADC_SAMPLETIME_181CYCLES_5;
+  sConfig.OffsetNumber = ADC_OFFSET_NONE;
+  sConfig.Offset = 0;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+   */
+  sConfig.Channel = ADC_CHANNEL_2;
+  sConfig.Rank = ADC_REGULAR_RANK_2;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+   */
+  sConfig.Channel = ADC_CHANNEL_3;
+  sConfig.Rank = ADC_REGULAR_RANK_3;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+   */
+  sConfig.Channel = ADC_CHANNEL_4;
+  sConfig.Rank = ADC_REGULAR_RANK_4;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN ADC1_Init 2 */
+
+  /* USER CODE END ADC1_Init 2 */
+}
+
+/**
+ * @brief I2C1 Initialization Function
+ * @param None
+ * @retval None
+ */
+static void MX_I2C1_Init(void)
+{
+
+  /* USER CODE BEGIN I2C1_Init 0 */
+
+  /* USER CODE END I2C1_Init 0 */
+
+  /* USER CODE BEGIN I2C1_Init 1 */
+
+  /* USER CODE END I2C1_Init 1 */
+  hi2c1.Instance = I2C1;
+  hi2c1.Init.Timing = 0x2000090E;
+  hi2c1.Init.OwnAddress1 = 0;
+  hi2c1.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+  hi2c1.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+  hi2c1.Init.OwnAddress2 = 0;
+  hi2c1.Init.OwnAddress2Masks = I2C_OA2_NOMASK;
+  hi2c1.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+  hi2c1.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+  if (HAL_I2C_Init(&hi2c1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Analogue filter
+   */
+  if (HAL_I2CEx_ConfigAnalogFilter(&hi2c1, I2C_ANALOGFILTER_ENABLE) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Digital filter
+   */
+  if (HAL_I2CEx_ConfigDigitalFilter(&hi2c1, 0) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN I2C1_Init 2 */
+
+  /* USER CODE END I2C1_Init 2 */
+}
+
+/**
+ * @brief TIM2 Initialization Function
+ * @param None
+ * @retval None
+ */
+static void MX_TIM2_Init(void)
+{
+
+  /* USER CODE BEGIN TIM2_Init 0 */
+
+  /* USER CODE END TIM2_Init 0 */
+
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  TIM_OC_InitTypeDef sConfigOC = {0};
+
+  /* USER CODE BEGIN TIM2_Init 1 */
+  // Free-running 32-bit counter at the core clock: run-time stats and the
+  // USART1 latency probe (channel 1); started by the kernel, see task_stats.c
+  /* USER CODE END TIM2_Init 1 */
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = 0;
+  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim2.Init.Period = 4294967295;
+  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim2, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_OC_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim2, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfigOC.OCMode = TIM_OCMODE_TIMING;
+  sConfigOC.Pulse = 0;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  if (HAL_TIM_OC_ConfigChannel(&htim2, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_OC_ConfigChannel(&htim2, &sConfigOC, TIM_CHANNEL_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM2_Init 2 */
+
+  /* USER CODE END TIM2_Init 2 */
+}
+
 /**
  * @brief USART1 Initialization Function
  * @param None
@@ -280,6 +550,9 @@ static void MX_DMA_Init(void)
   __HAL_RCC_DMA1_CLK_ENABLE();
 
   /* DMA interrupt init */
+  /* DMA1_Channel1_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
   /* DMA1_Channel4_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(DMA1_Channel4_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(DMA1_Channel4_IRQn);
@@ -295,6 +568,7 @@ static void MX_DMA_Init(void)
  */
 static void MX_GPIO_Init(void)
 {
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
   /* USER CODE BEGIN MX_GPIO_Init_1 */
 
   /* USER CODE END MX_GPIO_Init_1 */
@@ -303,13 +577,43 @@ static void MX_GPIO_Init(void)
   __HAL_RCC_GPIOA_CLK_ENABLE();
   __HAL_RCC_GPIOB_CLK_ENABLE();
 
-  /* USER CODE BEGIN MX_GPIO_Init_2 */
+  /*Configure GPIO pins : PA4 PA5 PA6 PA7 */
+  GPIO_InitStruct.Pin = GPIO_PIN_4 | GPIO_PIN_5 | GPIO_PIN_6 | GPIO_PIN_7;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
+  /* USER CODE BEGIN MX_GPIO_Init_2 */
+#if SCD30_USE_RDY_PIN
+  /*Configure GPIO pin : PB0 (SCD30 RDY, rising edge) */
+  GPIO_InitStruct.Pin = SCD30_RDY_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN; // Keeps the line low if RDY is not wired
+  HAL_GPIO_Init(SCD30_RDY_GPIO, &GPIO_InitStruct);
+
+  /* EXTI interrupt init - the callback uses the RTOS, so not above the syscall priority */
+  HAL_NVIC_SetPriority(SCD30_RDY_EXTI_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(SCD30_RDY_EXTI_IRQn);
+#endif
   /* USER CODE END MX_GPIO_Init_2 */
 }
 
 /* USER CODE BEGIN 4 */
 
+/**
+ * @brief  EXTI line detection callback
+ * @param  GPIO_Pin: Pin that triggered the interrupt
+ * @retval None
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == SCD30_RDY_PIN)
+  {
+    // SCD30 signals a new measurement - wake the SCD30 task to read it
+    SCD30_RdyCallback();
+  }
+}
+
 /* USER CODE END 4 */
 
 /* USER CODE BEGIN Header_StartDefaultTask */
@@ -322,10 +626,30 @@ static void MX_GPIO_Init(void)
 void StartDefaultTask(void *argument)
 {
   /* USER CODE BEGIN 5 */
+  // Publisher: maps new sensor data to the registers. It outranks both sensor
+  // tasks, so it runs as soon as one signals and reads a finished update.
   /* Infinite loop */
   for (;;)
   {
-    osDelay(1);
+    uint32_t events = osEventFlagsWait(sensorEventsHandle, SENSOR_EVENT_MQ2 | SENSOR_EVENT_SCD30,
+                                       osFlagsWaitAny, PUBLISH_TIMEOUT_MS);
+
+    if (!(events & osFlagsError))
+    {
+      if (events & SENSOR_EVENT_MQ2)
+      {
+        Modbus_Device_UpdateMQ2();
+      }
+      if (events & SENSOR_EVENT_SCD30)
+      {
+        Modbus_Device_UpdateSCD30();
+      }
+    }
+
+    Modbus_Device_UpdateUptime();
+
+    // CPU load, stack headroom and USART1 latency, once per statistics window
+    Modbus_Device_UpdateStats();
   }
   /* USER CODE END 5 */
 }
@@ -343,35 +667,72 @@ void ModbusCommunicationTask(void *argument)
   /* Infinite loop */
   for (;;)
   {
-    // Process Modbus communication
+    // Blocks until the UART ISR queues a frame, then parses and answers it
     Modbus_Process();
-
-    // Small delay to prevent busy waiting
-    osDelay(10);
   }
   /* USER CODE END ModbusCommunicationTask */
 }
 
-/* USER CODE BEGIN Header_SensorUpdateTask */
+/* USER CODE BEGIN Header_MQ2UpdateTask */
+/**
+ * @brief  Function implementing the MQ2UpdateTask thread.
+ * @param  argument: Not used
+ * @retval None
+ */
+/* USER CODE END Header_MQ2UpdateTask */
+void MQ2UpdateTask(void *argument)
+{
+  /* USER CODE BEGIN MQ2UpdateTask */
+  // ADC scan sequence and calibration
+  Sensors_StartMQ2();
+
+  uint32_t wake = osKernelGetTickCount();
+
+  /* Infinite loop */
+  for (;;)
+  {
+    // ADC scan (the task sleeps during the conversions), gas model, compensation
+    Sensors_UpdateMQ2();
+    osEventFlagsSet(sensorEventsHandle, SENSOR_EVENT_MQ2);
+
+    // Fixed rate; resynchronise if an update overran, since osDelayUntil()
+    // would otherwise wait for a tick count that has already passed
+    wake += MQ2_UPDATE_PERIOD_MS;
+    if ((int32_t)(wake - osKernelGetTickCount()) <= 0)
+    {
+      wake = osKernelGetTickCount() + MQ2_UPDATE_PERIOD_MS;
+    }
+    osDelayUntil(wake);
+  }
+  /* USER CODE END MQ2UpdateTask */
+}
+
+/* USER CODE BEGIN Header_SCD30UpdateTask */
 /**
- * @brief  Function implementing the SensorUpdateTask thread.
+ * @brief  Function implementing the SCD30UpdateTask thread.
  * @param  argument: Not used
  * @retval None
  */
-/* USER CODE END Header_SensorUpdateTask */
-void SensorUpdateTask(void *argument)
+/* USER CODE END Header_SCD30UpdateTask */
+void SCD30UpdateTask(void *argument)
 {
-  /* USER CODE BEGIN SensorUpdateTask */
+  /* USER CODE BEGIN SCD30UpdateTask */
+  // Lowest application priority: the blocking I2C transfers only use time
+  // no other task wants, and the Modbus task preempts them at any byte
+  osDelay(SCD30_STARTUP_MS);
+  Sensors_StartSCD30();
+
   /* Infinite loop */
   for (;;)
   {
-    // Update test values
-    Modbus_Test_Update();
+    // Pending settings, then the measurement if one is ready
+    Sensors_UpdateSCD30();
+    osEventFlagsSet(sensorEventsHandle, SENSOR_EVENT_SCD30);
 
-    // Delay for 100ms between updates
-    osDelay(100);
+    // RDY edge, or one measurement interval when polling
+    SCD30_WaitForData(scd30_config.value[SCD30_CFG_INTERVAL] * 1000UL);
   }
-  /* USER CODE END SensorUpdateTask */
+  /* USER CODE END SCD30UpdateTask */
 }
 
 /**
@@ -6,16 +6,172 @@
 
 #include "modbus_device.h"
 #include "cmsis_os.h"
+#include "sensors.h"
+#include <math.h>
 
 /* Private variables */
 uint16_t device_registers[MODBUS_DEVICE_REGISTERS] = {
     20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
     10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+uint16_t input_registers[MODBUS_INPUT_REG_COUNT] = {0};
+
+// Register bank lock; FreeRTOS mutexes inherit priority, so a lower priority
+// holder is raised while the Modbus task waits for it
+static osMutexId_t device_lock;
+static StaticSemaphore_t device_lock_cb;
+static const osMutexAttr_t device_lock_attributes = {
+    .name = "registerLock",
+    .attr_bits = osMutexPrioInherit,
+    .cb_mem = &device_lock_cb,
+    .cb_size = sizeof(device_lock_cb),
+};
 
 /* Private function prototypes */
+static uint16_t Float_To_ModbusRegister(float value, float scale);
+
+/* Private functions */
+
+/**
+ * @brief  Convert float to Modbus register with scaling
+ * @param  value: Float value to convert
+ * @param  scale: Scaling factor
+ * @retval Scaled value clamped to 0-65535
+ */
+static uint16_t Float_To_ModbusRegister(float value, float scale)
+{
+    // Handle invalid values
+    if (isnan(value) || isinf(value))
+        return 0;
+
+    // Scale and clamp to 16-bit range
+    int32_t scaled = (int32_t)(value * scale);
+    if (scaled < 0)
+        scaled = 0;
+    if (scaled > 65535)
+        scaled = 65535;
+
+    return (uint16_t)scaled;
+}
 
 /* Exported functions */
 
+/**
+ * @brief  Create the register bank lock
+ * @param  None
+ * @retval None
+ * @note   Call after osKernelInitialize(), before the tasks start.
+ */
+void Modbus_Device_Init(void)
+{
+    device_lock = osMutexNew(&device_lock_attributes);
+}
+
+/**
+ * @brief  Take the register bank (Modbus task and sensor publisher)
+ * @param  None
+ * @retval None
+ */
+void Modbus_Device_Lock(void)
+{
+    osMutexAcquire(device_lock, osWaitForever);
+}
+
+/**
+ * @brief  Release the register bank
+ * @param  None
+ * @retval None
+ */
+void Modbus_Device_Unlock(void)
+{
+    osMutexRelease(device_lock);
+}
+
+/**
+ * @brief  Map the latest MQ2 scan to registers 40001-40012 and 40018
+ * @param  None
+ * @retval None
+ * @note   Runs in the publisher task, which outranks the MQ2 task, so the
+ *         scan it reads is complete.
+ */
+void Modbus_Device_UpdateMQ2(void)
+{
+    Modbus_Device_Lock();
+
+    for (uint8_t i = 0; i < MQ2_NUM_CHANNELS; i++)
+    {
+        device_registers[i] = Sensors_GetMQ2Value(i);               // 40001-40004: MQ2 raw ADC
+        device_registers[4 + i] = Sensors_GetMQ2Voltage(i);         // 40005-40008: MQ2 mV
+        device_registers[8 + i] = Sensors_GetMQ2Digital(i) ? 1 : 0; // 40009-40012: 1=gas, 0=no gas
+    }
+    device_registers[17] = (uint16_t)(sensor_data.last_update / 1000); // 40018: Last sensor update (s)
+
+    Modbus_Device_Unlock();
+}
+
+/**
+ * @brief  Map the latest SCD30 measurement to registers 40013-40016 and 40018
+ * @param  None
+ * @retval None
+ * @note   Runs in the publisher task, which outranks the SCD30 task.
+ */
+void Modbus_Device_UpdateSCD30(void)
+{
+    float temperature = Sensors_GetSCD30_Temperature();
+
+    Modbus_Device_Lock();
+
+    device_registers[12] = Float_To_ModbusRegister(Sensors_GetSCD30_CO2(), 1.0f); // 40013: CO2 ppm
+    if (temperature < -50.0f || temperature > 85.0f)
+    {
+        device_registers[13] = 0xFFFF; // 40014: 65535 indicates sensor error
+    }
+    else
+    {
+        device_registers[13] = (uint16_t)(temperature * 100.0f); // 40014: Temperature (°C x 100)
+    }
+    device_registers[14] = Float_To_ModbusRegister(Sensors_GetSCD30_Humidity(), 100.0f); // 40015: Humidity (% x 100)
+    device_registers[15] = sensor_data.scd30_data_ready ? 1 : 0;                        // 40016: SCD30 data ready flag
+    device_registers[17] = (uint16_t)(sensor_data.last_update / 1000);                  // 40018: Last sensor update (s)
+
+    Modbus_Device_Unlock();
+}
+
+/**
+ * @brief  Refresh the uptime register 40017
+ * @param  None
+ * @retval None
+ */
+void Modbus_Device_UpdateUptime(void)
+{
+    Modbus_Device_Lock();
+    device_registers[16] = (uint16_t)(HAL_GetTick() / 1000); // 40017: System uptime (s)
+    Modbus_Device_Unlock();
+}
+
+/**
+ * @brief  Refresh the statistics input registers 30001-30019 when a window closes
+ * @param  None
+ * @retval None
+ */
+void Modbus_Device_UpdateStats(void)
+{
+    // The stack walk runs without the lock, so Modbus requests are not held up
+    if (!TaskStats_Sample())
+        return;
+    LowPower_Sample(TaskStats_ReadRegister(TASK_STATS_REG_WINDOW_MS));
+
+    Modbus_Device_Lock();
+    for (uint8_t i = 0; i < TASK_STATS_REG_COUNT; i++)
+    {
+        input_registers[i] = TaskStats_ReadRegister(i);
+    }
+    for (uint8_t i = 0; i < LOWPOWER_REG_COUNT; i++)
+    {
+        input_registers[MODBUS_INPUT_REG_LOWPOWER + i] = LowPower_ReadRegister(i);
+    }
+    Modbus_Device_Unlock();
+}
+
 /**
  * @brief  Get register value by index
  * @param  index: Register index (0-19)
@@ -44,6 +200,13 @@ uint16_t Modbus_Device_Read(uint32_t logical_address)
         return device_registers[index];
     }
 
+    // Input registers 30001+ (RTOS statistics)
+    if (logical_address >= MODBUS_INPUT_REG_BASE &&
+        logical_address < MODBUS_INPUT_REG_BASE + MODBUS_INPUT_REG_COUNT)
+    {
+        return input_registers[logical_address - MODBUS_INPUT_REG_BASE];
+    }
+
     return 0; // Invalid address
 }
 
@@ -7,8 +7,12 @@
 #include "modbus_init.h"
 #include "main.h"
 #include "modbus_device.h"
-#include "mbutils.h"
+#include "mbport.h"
 #include <stdio.h>
+#include <string.h>
+
+/* Private defines */
+#define MODBUS_TX_TIMEOUT_MS 1000
 
 /* Private variables */
 extern UART_HandleTypeDef huart1;
@@ -17,8 +21,12 @@ static Modbus_Conf_t modbus_config;
 uint8_t modbus_rx_buffer[MODBUS_RX_BUFFER_SIZE];
 uint8_t modbus_tx_buffer[MODBUS_TX_BUFFER_SIZE];
 
+static uint8_t modbus_frame[MODBUS_RX_BUFFER_SIZE]; // Frame being parsed by the Modbus task
+static uint8_t modbus_tx_pending;                   // A reply was handed to the DMA and has not finished
+
 /* Private function prototypes */
-static int Modbus_SendData(void *context, const uint8_t *data, const uint16_t size);
+static int Modbus_SendData(const mbus_t context, const uint8_t *data, const uint16_t size);
+static void Modbus_WaitTransmit(void);
 
 /* Exported functions */
 
@@ -37,19 +45,23 @@ void Modbus_Init(void)
     modbus_config.send = Modbus_SendData;
     modbus_config.read = Modbus_Device_Read;
     modbus_config.write = Modbus_Device_Write;
-    modbus_config.sendbuf = modbus_tx_buffer;
+    modbus_config.sendbuf = modbus_tx_buffer; // Replies are built in place for the DMA
     modbus_config.sendbuf_sz = sizeof(modbus_tx_buffer);
-    modbus_config.recvbuf = modbus_rx_buffer;
-    modbus_config.recvbuf_sz = sizeof(modbus_rx_buffer);
+    modbus_config.recvbuf = modbus_frame; // Request data trails the bytes being parsed
+    modbus_config.recvbuf_sz = sizeof(modbus_frame);
 
     // Initialize Modbus context
     modbus_context = mbus_open(&modbus_config);
 
+    // Created before reception starts so the first frame has somewhere to go
+    mbport_queue_init();
+
     // Note: device_registers are already initialized in modbus_device.c
     // with values: 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
 
-    // Start UART DMA reception
+    // Start UART DMA reception (no half-transfer event, a frame ends on idle line)
     HAL_UARTEx_ReceiveToIdle_DMA(&huart1, modbus_rx_buffer, sizeof(modbus_rx_buffer));
+    __HAL_DMA_DISABLE_IT(huart1.hdmarx, DMA_IT_HT);
 
     // Enable UART idle line interrupt
     __HAL_UART_ENABLE_IT(&huart1, UART_IT_IDLE);
@@ -58,14 +70,47 @@ void Modbus_Init(void)
 }
 
 /**
- * @brief  Process Modbus communication
+ * @brief  Wait for the next received frame and answer it (Modbus task)
  * @param  None
  * @retval None
+ * @note   Blocks until the UART ISR queues a frame; parsing, register access
+ *         and the reply all run in the calling task. The register bank is
+ *         held only while the frame is parsed, not while the reply is sent.
  */
 void Modbus_Process(void)
 {
-    // This function is called from RTOS task
-    // Processing is handled in UART callback
+    uint16_t size = mbport_queue_get(modbus_frame, sizeof(modbus_frame), MBPORT_WAIT_FOREVER);
+
+    Modbus_Device_Lock();
+
+    // A silent line ends a frame, so every frame starts with a fresh parser
+    mbus_poll_frame(modbus_context, modbus_frame, size);
+
+    Modbus_Device_Unlock();
+
+    Modbus_WaitTransmit();
+}
+
+/**
+ * @brief  Queue a received frame for the Modbus task (UART ISR)
+ * @param  data: Received bytes
+ * @param  size: Number of bytes
+ * @retval None
+ * @note   A frame that does not fit is dropped; the master retries on timeout.
+ */
+void Modbus_ReceiveFromISR(const uint8_t *data, uint16_t size)
+{
+    mbport_queue_put_from_isr(data, size);
+}
+
+/**
+ * @brief  Signal the end of a DMA transmission (UART ISR)
+ * @param  None
+ * @retval None
+ */
+void Modbus_TransmitCompleteFromISR(void)
+{
+    mbport_transmit_done_from_isr();
 }
 
 /* Private functions */
@@ -76,19 +121,52 @@ void Modbus_Process(void)
  * @param  data: Data to send
  * @param  size: Size of data
  * @retval Number of bytes sent
+ * @note   Only starts the DMA; Modbus_Process() waits for the end of the
+ *         transmission after releasing the register bank.
  */
-static int Modbus_SendData(void *context, const uint8_t *data, const uint16_t size)
+static int Modbus_SendData(const mbus_t context, const uint8_t *data, const uint16_t size)
 {
-    HAL_StatusTypeDef status = HAL_UART_Transmit(&huart1, (uint8_t *)data, size, 1000);
+    if (size > sizeof(modbus_tx_buffer) || modbus_tx_pending)
+    {
+        return 0;
+    }
 
-    if (status == HAL_OK)
+    // The engine builds replies in modbus_tx_buffer already
+    if (data != modbus_tx_buffer)
     {
-        return size;
+        memcpy(modbus_tx_buffer, data, size);
     }
-    else
+
+    mbport_transmit_begin();
+
+    if (HAL_UART_Transmit_DMA(&huart1, modbus_tx_buffer, size) != HAL_OK)
     {
         return 0;
     }
+
+    modbus_tx_pending = 1;
+    return size;
+}
+
+/**
+ * @brief  Wait for the reply started by Modbus_SendData() to leave the UART
+ * @param  None
+ * @retval None
+ */
+static void Modbus_WaitTransmit(void)
+{
+    if (!modbus_tx_pending)
+    {
+        return;
+    }
+
+    // Sleep until transmission complete (RS485 DE drops in hardware); other tasks run meanwhile
+    if (!mbport_transmit_wait(MODBUS_TX_TIMEOUT_MS))
+    {
+        HAL_UART_AbortTransmit(&huart1);
+    }
+
+    modbus_tx_pending = 0;
 }
 
 /**
@@ -99,4 +177,4 @@ static int Modbus_SendData(void *context, const uint8_t *data, const uint16_t si
 mbus_t Modbus_GetContext(void)
 {
     return modbus_context;
-}
\ No newline at end of file
+}
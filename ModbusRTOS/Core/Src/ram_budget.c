@@ -0,0 +1,74 @@
+/**
+ * @file    ram_budget.c
+ * @brief   Compile-time RAM budget report and checks
+ * @author  Generated for RTOS version
+ *
+ * Contains no code. Compiling it prints the budget from ram_budget.h as a
+ * table of compiler notes, checks each entry against the definition it
+ * describes and stops the build if a region is over budget. It is rebuilt
+ * whenever ram_budget.h, the FreeRTOS configuration or the buffer sizes
+ * change.
+ */
+
+#include "ram_budget.h"
+#include "cmsis_os.h"
+#include "modbus_init.h"
+#include "modbus_device.h"
+#include "list.h"
+#include "task.h"
+#include "message_buffer.h"
+#include "sensors.h"
+#include "task_stats.h"
+
+/* Private macros */
+#define RAM_STR_(x) #x
+#define RAM_STR(x) RAM_STR_(x)
+#define RAM_ROW(region, item, bytes) _Pragma(RAM_STR(message("RAM budget  " region "  " item "  " RAM_STR(bytes) " B")))
+
+/* Budget table */
+RAM_ROW("CCM ", "stack defaultTask         ", RAM_STACK_DEFAULT_TASK)
+RAM_ROW("CCM ", "stack ModbusComm          ", RAM_STACK_MODBUS_TASK)
+RAM_ROW("CCM ", "stack MQ2Update           ", RAM_STACK_MQ2_TASK)
+RAM_ROW("CCM ", "stack SCD30Update         ", RAM_STACK_SCD30_TASK)
+RAM_ROW("CCM ", "region size               ", RAM_CCM_SIZE)
+RAM_ROW("SRAM", "stack idle task           ", RAM_STACK_IDLE_TASK)
+RAM_ROW("SRAM", "stack timer task          ", RAM_STACK_TIMER_TASK)
+RAM_ROW("SRAM", "stack main (ISRs)         ", RAM_STACK_MAIN)
+RAM_ROW("SRAM", "buffer Modbus RX DMA      ", RAM_BUF_MODBUS_RX)
+RAM_ROW("SRAM", "buffer Modbus TX DMA      ", RAM_BUF_MODBUS_TX)
+RAM_ROW("SRAM", "buffer Modbus frame       ", RAM_BUF_MODBUS_FRAME)
+RAM_ROW("SRAM", "buffer Modbus RX queue    ", RAM_BUF_MODBUS_QUEUE)
+RAM_ROW("SRAM", "buffer ADC scan           ", RAM_BUF_ADC_SCAN)
+RAM_ROW("SRAM", "buffer libc heap          ", RAM_BUF_LIBC_HEAP)
+RAM_ROW("SRAM", "buffer task statistics    ", RAM_BUF_TASK_STATS)
+RAM_ROW("SRAM", "registers holding         ", RAM_REG_HOLDING)
+RAM_ROW("SRAM", "registers input           ", RAM_REG_INPUT)
+RAM_ROW("SRAM", "kernel task control blocks", RAM_KERNEL_TCB)
+RAM_ROW("SRAM", "kernel ready lists        ", RAM_KERNEL_READY_LISTS)
+RAM_ROW("SRAM", "kernel sync objects       ", RAM_KERNEL_SYNC)
+RAM_ROW("SRAM", "reserve other             ", RAM_RESERVE_OTHER)
+RAM_ROW("SRAM", "region size               ", RAM_SRAM_SIZE)
+
+/* Entries must match what they describe */
+_Static_assert(RAM_STACK_IDLE_TASK == configMINIMAL_STACK_SIZE * sizeof(StackType_t), "RAM budget: idle stack");
+_Static_assert(RAM_STACK_TIMER_TASK == configTIMER_TASK_STACK_DEPTH * sizeof(StackType_t), "RAM budget: timer stack");
+_Static_assert(RAM_BUF_MODBUS_RX == sizeof(modbus_rx_buffer), "RAM budget: Modbus RX buffer");
+_Static_assert(RAM_BUF_MODBUS_TX == sizeof(modbus_tx_buffer), "RAM budget: Modbus TX buffer");
+_Static_assert(RAM_BUF_MODBUS_FRAME == MODBUS_RX_BUFFER_SIZE, "RAM budget: Modbus frame buffer");
+_Static_assert(RAM_BUF_MODBUS_QUEUE == STMODBUS_QUEUE_SIZE + 1, "RAM budget: Modbus RX queue");
+_Static_assert(RAM_BUF_ADC_SCAN == ADC_SCAN_LENGTH * sizeof(uint16_t), "RAM budget: ADC scan buffer");
+_Static_assert(RAM_BUF_TASK_STATS == TASK_STATS_MAX_TASKS * sizeof(TaskStatus_t), "RAM budget: task statistics");
+_Static_assert(RAM_REG_HOLDING == sizeof(device_registers), "RAM budget: holding registers");
+_Static_assert(RAM_REG_INPUT == sizeof(input_registers), "RAM budget: input registers");
+_Static_assert(RAM_KERNEL_TCB == 6 * sizeof(StaticTask_t), "RAM budget: task control blocks");
+_Static_assert(RAM_KERNEL_READY_LISTS == configMAX_PRIORITIES * sizeof(List_t), "RAM budget: ready lists");
+_Static_assert(RAM_KERNEL_SYNC == sizeof(StaticSemaphore_t) + sizeof(StaticEventGroup_t) + sizeof(StaticMessageBuffer_t),
+               "RAM budget: sync objects");
+
+/* Regions must hold their budget */
+_Static_assert(RAM_CCM_USED <= RAM_CCM_SIZE, "RAM budget: CCM-RAM over budget");
+_Static_assert(RAM_SRAM_USED <= RAM_SRAM_SIZE, "RAM budget: SRAM over budget");
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+#error "RAM budget: kernel objects must be allocated statically"
+#endif
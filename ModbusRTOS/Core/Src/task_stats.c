@@ -0,0 +1,198 @@
+/**
+ * @file    task_stats.c
+ * @brief   Task CPU load, stack headroom and USART1 interrupt latency
+ * @author  Generated for RTOS version
+ *
+ * TIM2 runs free at the timer clock (8 MHz, one tick per core cycle) and is
+ * the FreeRTOS run-time stats counter. Its 32 bits wrap every 9 minutes,
+ * so loads come from counter differences over a 5 s window, never from the
+ * totals since boot.
+ *
+ * USART1 latency is measured with a probe. TIM2 channel 1 interrupts at
+ * priority 0, which nothing masks, records the counter and pends the
+ * USART1 interrupt. The USART1 handler reads the counter again on entry.
+ * The difference is the time USART1 stayed pending: higher priority
+ * interrupts and kernel critical sections (BASEPRI) both count, exactly as
+ * for a received frame. The probe period is not a multiple of the 1 ms
+ * tick, so over time it samples every phase of the tick interrupt.
+ */
+
+#include "task_stats.h"
+#include "cmsis_os.h"
+#include "task.h"
+
+/* Private variables */
+static volatile uint32_t probe_start;   // TIM2 count when the probe pended USART1
+static volatile uint8_t probe_pending;  // USART1 pended by the probe, not yet entered
+static volatile uint32_t latency_max;   // Since boot (TIM2 ticks)
+static volatile uint32_t latency_window; // Since the last sample (TIM2 ticks)
+
+static TaskStatus_t task_status[TASK_STATS_MAX_TASKS];
+static uint32_t task_runtime[TASK_STATS_MAX_TASKS]; // Run-time counters at the last sample
+static uint32_t window_counter;                     // TIM2 count at the last sample
+static uint32_t window_tick;                        // Kernel tick at the last sample
+
+static uint16_t stats_registers[TASK_STATS_REG_COUNT];
+
+/* Private function prototypes */
+static uint16_t TaskStats_Saturate(uint32_t value);
+static uint16_t TaskStats_Share(uint32_t part, uint32_t total);
+
+/* Private functions */
+
+/**
+ * @brief  Clamp a value to a 16-bit register
+ * @param  value: Value
+ * @retval value, or 0xFFFF if it does not fit
+ */
+static uint16_t TaskStats_Saturate(uint32_t value)
+{
+    return (value > 0xFFFF) ? 0xFFFF : (uint16_t)value;
+}
+
+/**
+ * @brief  Share of one count in another
+ * @param  part: Part
+ * @param  total: Whole
+ * @retval part / total (% x 100, 0-10000)
+ */
+static uint16_t TaskStats_Share(uint32_t part, uint32_t total)
+{
+    if (total == 0)
+        return 0;
+    if (part >= total)
+        return 10000;
+    return (uint16_t)((uint64_t)part * 10000 / total);
+}
+
+/* Exported functions */
+
+/**
+ * @brief  Start the run-time counter and the latency probe
+ * @param  None
+ * @retval None
+ * @note   Called by the kernel from vTaskStartScheduler().
+ */
+void TaskStats_StartTimer(void)
+{
+    __HAL_TIM_SET_COUNTER(&htim2, 0);
+    __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, TASK_STATS_PROBE_TICKS);
+    HAL_TIM_OC_Start_IT(&htim2, TIM_CHANNEL_1); // Also starts the counter
+}
+
+/**
+ * @brief  Run-time stats counter
+ * @param  None
+ * @retval TIM2 count
+ */
+uint32_t TaskStats_GetCounter(void)
+{
+    return __HAL_TIM_GET_COUNTER(&htim2);
+}
+
+/**
+ * @brief  Latency probe: pend USART1 and remember when (TIM2 ISR)
+ * @param  htim: TIM handle
+ * @retval None
+ */
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == TIM2)
+    {
+        __HAL_TIM_SET_COMPARE(htim, TIM_CHANNEL_1, __HAL_TIM_GET_COMPARE(htim, TIM_CHANNEL_1) + TASK_STATS_PROBE_TICKS);
+
+        // A probe still waiting for its handler keeps its start time
+        if (!probe_pending)
+        {
+            probe_start = __HAL_TIM_GET_COUNTER(htim);
+            probe_pending = 1;
+            NVIC_SetPendingIRQ(USART1_IRQn);
+        }
+    }
+}
+
+/**
+ * @brief  Record the latency of a probe (first thing in the USART1 ISR)
+ * @param  None
+ * @retval None
+ */
+void TaskStats_Usart1IrqEntry(void)
+{
+    uint32_t now = __HAL_TIM_GET_COUNTER(&htim2);
+
+    if (probe_pending)
+    {
+        uint32_t latency = now - probe_start;
+
+        probe_pending = 0;
+        if (latency > latency_max)
+            latency_max = latency;
+        if (latency > latency_window)
+            latency_window = latency;
+    }
+}
+
+/**
+ * @brief  Close the statistics window once it has elapsed (publisher task)
+ * @param  None
+ * @retval 1 if new values are available, 0 if the window is still open
+ * @note   Walks every task stack for its high-water mark; the scheduler is
+ *         suspended meanwhile, interrupts are not.
+ */
+uint8_t TaskStats_Sample(void)
+{
+    uint32_t tick = osKernelGetTickCount();
+
+    if (tick - window_tick < TASK_STATS_WINDOW_MS)
+        return 0;
+
+    uint32_t counter;
+    UBaseType_t count = uxTaskGetSystemState(task_status, TASK_STATS_MAX_TASKS, &counter);
+    uint32_t total = counter - window_counter;
+    TaskHandle_t idle = xTaskGetIdleTaskHandle();
+
+    taskENTER_CRITICAL();
+    uint32_t latency = latency_window;
+    latency_window = 0;
+    taskEXIT_CRITICAL();
+
+    stats_registers[TASK_STATS_REG_LATENCY_MAX] = TaskStats_Saturate(latency_max);
+    stats_registers[TASK_STATS_REG_LATENCY_WINDOW] = TaskStats_Saturate(latency);
+    stats_registers[TASK_STATS_REG_WINDOW_MS] = TaskStats_Saturate(tick - window_tick);
+    stats_registers[TASK_STATS_REG_CPU_LOAD] = 0;
+
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        const TaskStatus_t *t = &task_status[i];
+        UBaseType_t slot = t->xTaskNumber - 1; // Numbered from 1 in creation order
+
+        if (slot >= TASK_STATS_MAX_TASKS)
+            continue;
+
+        uint16_t load = TaskStats_Share(t->ulRunTimeCounter - task_runtime[slot], total);
+        task_runtime[slot] = t->ulRunTimeCounter;
+
+        stats_registers[TASK_STATS_REG_TASKS + 2 * slot] = load;
+        stats_registers[TASK_STATS_REG_TASKS + 2 * slot + 1] =
+            TaskStats_Saturate(t->usStackHighWaterMark * sizeof(StackType_t));
+
+        if (t->xHandle == idle)
+            stats_registers[TASK_STATS_REG_CPU_LOAD] = 10000 - load;
+    }
+
+    window_counter = counter;
+    window_tick = tick;
+    return 1;
+}
+
+/**
+ * @brief  Read one register of the statistics block
+ * @param  reg: Register (TASK_STATS_REG_*)
+ * @retval Value from the last closed window
+ */
+uint16_t TaskStats_ReadRegister(uint8_t reg)
+{
+    if (reg < TASK_STATS_REG_COUNT)
+        return stats_registers[reg];
+    return 0;
+}
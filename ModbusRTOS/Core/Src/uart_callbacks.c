@@ -37,6 +37,7 @@ void UART_Callbacks_Init(void)
 static void UART_RestartDmaReception(void)
 {
     HAL_UARTEx_ReceiveToIdle_DMA(&huart1, modbus_rx_buffer, sizeof(modbus_rx_buffer));
+    __HAL_DMA_DISABLE_IT(huart1.hdmarx, DMA_IT_HT);
 }
 
 /* HAL UART Callbacks */
@@ -51,23 +52,32 @@ void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
 {
     if (huart == &huart1)
     {
-        // Get Modbus context
-        mbus_t modbus_ctx = Modbus_GetContext();
-
-        // Process received Modbus data byte by byte
-        for (uint16_t i = 0; i < Size; i++)
-        {
-            mbus_poll(modbus_ctx, modbus_rx_buffer[i]);
-        }
-
         // Clear UART idle flag
         __HAL_UART_CLEAR_IDLEFLAG(huart);
 
+        // Copy the frame out before the DMA overwrites the buffer; the
+        // Modbus task parses it
+        Modbus_ReceiveFromISR(modbus_rx_buffer, Size);
+
         // Restart DMA reception
         UART_RestartDmaReception();
     }
 }
 
+/**
+ * @brief  UART transmit complete callback
+ * @param  huart: UART handle
+ * @retval None
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == &huart1)
+    {
+        // Wake the Modbus task waiting in Modbus_SendData()
+        Modbus_TransmitCompleteFromISR();
+    }
+}
+
 /**
  * @brief  UART error callback
  * @param  huart: UART handle
@@ -77,6 +87,10 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
     if (huart == &huart1)
     {
+        // Lost characters count towards FC08 sub-function 0x12
+        if (huart->ErrorCode & HAL_UART_ERROR_ORE)
+            mbus_char_overrun(Modbus_GetContext());
+
         // Clear error flags
         __HAL_UART_CLEAR_OREFLAG(huart);
         __HAL_UART_CLEAR_NEFLAG(huart);
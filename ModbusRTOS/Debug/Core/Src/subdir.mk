@@ -6,58 +6,58 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Core/Src/freertos.c \
+../Core/Src/lowpower.c \
 ../Core/Src/main.c \
-../Core/Src/mbutils.c \
-../Core/Src/modbus.c \
 ../Core/Src/modbus_device.c \
 ../Core/Src/modbus_init.c \
-../Core/Src/modbus_test.c \
+../Core/Src/ram_budget.c \
 ../Core/Src/stm32f3xx_hal_msp.c \
 ../Core/Src/stm32f3xx_hal_timebase_tim.c \
 ../Core/Src/stm32f3xx_it.c \
 ../Core/Src/sysmem.c \
 ../Core/Src/system_stm32f3xx.c \
+../Core/Src/task_stats.c \
 ../Core/Src/uart_callbacks.c 
 
 OBJS += \
 ./Core/Src/freertos.o \
+./Core/Src/lowpower.o \
 ./Core/Src/main.o \
-./Core/Src/mbutils.o \
-./Core/Src/modbus.o \
 ./Core/Src/modbus_device.o \
 ./Core/Src/modbus_init.o \
-./Core/Src/modbus_test.o \
+./Core/Src/ram_budget.o \
 ./Core/Src/stm32f3xx_hal_msp.o \
 ./Core/Src/stm32f3xx_hal_timebase_tim.o \
 ./Core/Src/stm32f3xx_it.o \
 ./Core/Src/sysmem.o \
 ./Core/Src/system_stm32f3xx.o \
+./Core/Src/task_stats.o \
 ./Core/Src/uart_callbacks.o 
 
 C_DEPS += \
 ./Core/Src/freertos.d \
+./Core/Src/lowpower.d \
 ./Core/Src/main.d \
-./Core/Src/mbutils.d \
-./Core/Src/modbus.d \
 ./Core/Src/modbus_device.d \
 ./Core/Src/modbus_init.d \
-./Core/Src/modbus_test.d \
+./Core/Src/ram_budget.d \
 ./Core/Src/stm32f3xx_hal_msp.d \
 ./Core/Src/stm32f3xx_hal_timebase_tim.d \
 ./Core/Src/stm32f3xx_it.d \
 ./Core/Src/sysmem.d \
 ./Core/Src/system_stm32f3xx.d \
+./Core/Src/task_stats.d \
 ./Core/Src/uart_callbacks.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
 Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
-	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -I../Middlewares/Third_Party/FreeRTOS/Source/include -I../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -I../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -I../Middlewares/Third_Party/FreeRTOS/Source/include -I../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -I../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/freertos.cyclo ./Core/Src/freertos.d ./Core/Src/freertos.o ./Core/Src/freertos.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/mbutils.cyclo ./Core/Src/mbutils.d ./Core/Src/mbutils.o ./Core/Src/mbutils.su ./Core/Src/modbus.cyclo ./Core/Src/modbus.d ./Core/Src/modbus.o ./Core/Src/modbus.su ./Core/Src/modbus_device.cyclo ./Core/Src/modbus_device.d ./Core/Src/modbus_device.o ./Core/Src/modbus_device.su ./Core/Src/modbus_init.cyclo ./Core/Src/modbus_init.d ./Core/Src/modbus_init.o ./Core/Src/modbus_init.su ./Core/Src/modbus_test.cyclo ./Core/Src/modbus_test.d ./Core/Src/modbus_test.o ./Core/Src/modbus_test.su ./Core/Src/stm32f3xx_hal_msp.cyclo ./Core/Src/stm32f3xx_hal_msp.d ./Core/Src/stm32f3xx_hal_msp.o ./Core/Src/stm32f3xx_hal_msp.su ./Core/Src/stm32f3xx_hal_timebase_tim.cyclo ./Core/Src/stm32f3xx_hal_timebase_tim.d ./Core/Src/stm32f3xx_hal_timebase_tim.o ./Core/Src/stm32f3xx_hal_timebase_tim.su ./Core/Src/stm32f3xx_it.cyclo ./Core/Src/stm32f3xx_it.d ./Core/Src/stm32f3xx_it.o ./Core/Src/stm32f3xx_it.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f3xx.cyclo ./Core/Src/system_stm32f3xx.d ./Core/Src/system_stm32f3xx.o ./Core/Src/system_stm32f3xx.su ./Core/Src/uart_callbacks.cyclo ./Core/Src/uart_callbacks.d ./Core/Src/uart_callbacks.o ./Core/Src/uart_callbacks.su
+	-$(RM) ./Core/Src/freertos.cyclo ./Core/Src/freertos.d ./Core/Src/freertos.o ./Core/Src/freertos.su ./Core/Src/lowpower.cyclo ./Core/Src/lowpower.d ./Core/Src/lowpower.o ./Core/Src/lowpower.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/modbus_device.cyclo ./Core/Src/modbus_device.d ./Core/Src/modbus_device.o ./Core/Src/modbus_device.su ./Core/Src/modbus_init.cyclo ./Core/Src/modbus_init.d ./Core/Src/modbus_init.o ./Core/Src/modbus_init.su ./Core/Src/ram_budget.cyclo ./Core/Src/ram_budget.d ./Core/Src/ram_budget.o ./Core/Src/ram_budget.su ./Core/Src/stm32f3xx_hal_msp.cyclo ./Core/Src/stm32f3xx_hal_msp.d ./Core/Src/stm32f3xx_hal_msp.o ./Core/Src/stm32f3xx_hal_msp.su ./Core/Src/stm32f3xx_hal_timebase_tim.cyclo ./Core/Src/stm32f3xx_hal_timebase_tim.d ./Core/Src/stm32f3xx_hal_timebase_tim.o ./Core/Src/stm32f3xx_hal_timebase_tim.su ./Core/Src/stm32f3xx_it.cyclo ./Core/Src/stm32f3xx_it.d ./Core/Src/stm32f3xx_it.o ./Core/Src/stm32f3xx_it.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f3xx.cyclo ./Core/Src/system_stm32f3xx.d ./Core/Src/system_stm32f3xx.o ./Core/Src/system_stm32f3xx.su ./Core/Src/task_stats.cyclo ./Core/Src/task_stats.d ./Core/Src/task_stats.o ./Core/Src/task_stats.su ./Core/Src/uart_callbacks.cyclo ./Core/Src/uart_callbacks.d ./Core/Src/uart_callbacks.o ./Core/Src/uart_callbacks.su
 
 .PHONY: clean-Core-2f-Src
 
@@ -28,5 +28,8 @@ Drivers/STM32F3xx_HAL_Driver/Src \
 Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 \
 Middlewares/Third_Party/FreeRTOS/Source \
 Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F \
-Middlewares/Third_Party/FreeRTOS/Source/portable/MemMang \
+stModbus/Src \
+stModbus/port/freertos \
+stSensors/Src \
+stSensors/port/freertos \
 
@@ -0,0 +1,27 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+# Toolchain: GNU Tools for STM32 (13.3.rel1)
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../../stModbus/port/freertos/mbport.c 
+
+OBJS += \
+./stModbus/port/freertos/mbport.o 
+
+C_DEPS += \
+./stModbus/port/freertos/mbport.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+stModbus/port/freertos/%.o stModbus/port/freertos/%.su stModbus/port/freertos/%.cyclo: ../../stModbus/port/freertos/%.c stModbus/port/freertos/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -I../Middlewares/Third_Party/FreeRTOS/Source/include -I../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -I../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+
+clean: clean-stModbus-2f-port-2f-freertos
+
+clean-stModbus-2f-port-2f-freertos:
+	-$(RM) ./stModbus/port/freertos/mbport.cyclo ./stModbus/port/freertos/mbport.d ./stModbus/port/freertos/mbport.o ./stModbus/port/freertos/mbport.su
+
+.PHONY: clean-stModbus-2f-port-2f-freertos
+
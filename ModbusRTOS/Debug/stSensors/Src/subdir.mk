@@ -0,0 +1,36 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+# Toolchain: GNU Tools for STM32 (13.3.rel1)
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../../stSensors/Src/health.c \
+../../stSensors/Src/mq2_gas.c \
+../../stSensors/Src/scd30_crc.c \
+../../stSensors/Src/sensors.c 
+
+OBJS += \
+./stSensors/Src/health.o \
+./stSensors/Src/mq2_gas.o \
+./stSensors/Src/scd30_crc.o \
+./stSensors/Src/sensors.o 
+
+C_DEPS += \
+./stSensors/Src/health.d \
+./stSensors/Src/mq2_gas.d \
+./stSensors/Src/scd30_crc.d \
+./stSensors/Src/sensors.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+stSensors/Src/%.o stSensors/Src/%.su stSensors/Src/%.cyclo: ../../stSensors/Src/%.c stSensors/Src/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -I../Middlewares/Third_Party/FreeRTOS/Source/include -I../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -I../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+
+clean: clean-stSensors-2f-Src
+
+clean-stSensors-2f-Src:
+	-$(RM) ./stSensors/Src/health.cyclo ./stSensors/Src/health.d ./stSensors/Src/health.o ./stSensors/Src/health.su ./stSensors/Src/mq2_gas.cyclo ./stSensors/Src/mq2_gas.d ./stSensors/Src/mq2_gas.o ./stSensors/Src/mq2_gas.su ./stSensors/Src/scd30_crc.cyclo ./stSensors/Src/scd30_crc.d ./stSensors/Src/scd30_crc.o ./stSensors/Src/scd30_crc.su ./stSensors/Src/sensors.cyclo ./stSensors/Src/sensors.d ./stSensors/Src/sensors.o ./stSensors/Src/sensors.su
+
+.PHONY: clean-stSensors-2f-Src
+
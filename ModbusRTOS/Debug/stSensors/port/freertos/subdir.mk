@@ -0,0 +1,27 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+# Toolchain: GNU Tools for STM32 (13.3.rel1)
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../../stSensors/port/freertos/snport.c 
+
+OBJS += \
+./stSensors/port/freertos/snport.o 
+
+C_DEPS += \
+./stSensors/port/freertos/snport.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+stSensors/port/freertos/%.o stSensors/port/freertos/%.su stSensors/port/freertos/%.cyclo: ../../stSensors/port/freertos/%.c stSensors/port/freertos/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -I../Middlewares/Third_Party/FreeRTOS/Source/include -I../Middlewares/Third_Party/FreeRTOS/Source/CMSIS_RTOS_V2 -I../Middlewares/Third_Party/FreeRTOS/Source/portable/GCC/ARM_CM4F -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+
+clean: clean-stSensors-2f-port-2f-freertos
+
+clean-stSensors-2f-port-2f-freertos:
+	-$(RM) ./stSensors/port/freertos/snport.cyclo ./stSensors/port/freertos/snport.d ./stSensors/port/freertos/snport.o ./stSensors/port/freertos/snport.su
+
+.PHONY: clean-stSensors-2f-port-2f-freertos
+
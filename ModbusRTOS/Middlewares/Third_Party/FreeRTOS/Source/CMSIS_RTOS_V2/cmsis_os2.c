@@ -401,9 +401,11 @@ osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAtt
     }
     else {
       if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         if (xTaskCreate ((TaskFunction_t)func, name, (uint16_t)stack, argument, prio, &hTask) != pdPASS) {
           hTask = NULL;
         }
+        #endif
       }
     }
   }
@@ -613,6 +615,7 @@ uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
   uint32_t i, count;
   TaskStatus_t *task;
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   if (IS_IRQ() || (thread_array == NULL) || (array_items == 0U)) {
     count = 0U;
   } else {
@@ -633,6 +636,11 @@ uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
 
     vPortFree (task);
   }
+#else
+  (void)i;
+  (void)task;
+  count = 0U;
+#endif
 
   return (count);
 }
@@ -843,6 +851,7 @@ osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument,
 
   hTimer = NULL;
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   if (!IS_IRQ() && (func != NULL)) {
     /* Allocate memory to store callback function and argument */
     callb = pvPortMalloc (sizeof(TimerCallback_t));
@@ -888,6 +897,16 @@ osTimerId_t osTimerNew (osTimerFunc_t func, osTimerType_t type, void *argument,
       }
     }
   }
+#else
+  /* The callback record is allocated from the heap even for static timers */
+  (void)name;
+  (void)callb;
+  (void)reload;
+  (void)mem;
+  (void)type;
+  (void)argument;
+  (void)attr;
+#endif
 
   return ((osTimerId_t)hTimer);
 }
@@ -968,7 +987,7 @@ uint32_t osTimerIsRunning (osTimerId_t timer_id) {
 osStatus_t osTimerDelete (osTimerId_t timer_id) {
   TimerHandle_t hTimer = (TimerHandle_t)timer_id;
   osStatus_t stat;
-#ifndef USE_FreeRTOS_HEAP_1
+#if !defined(USE_FreeRTOS_HEAP_1) && (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   TimerCallback_t *callb;
 
   if (IS_IRQ()) {
@@ -988,6 +1007,7 @@ osStatus_t osTimerDelete (osTimerId_t timer_id) {
     }
   }
 #else
+  (void)hTimer;
   stat = osError;
 #endif
 
@@ -1024,7 +1044,9 @@ osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
     }
     else {
       if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         hEventGroup = xEventGroupCreate();
+        #endif
       }
     }
   }
@@ -1220,11 +1242,13 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
       }
       else {
         if (mem == 0) {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
           if (rmtx != 0U) {
             hMutex = xSemaphoreCreateRecursiveMutex ();
           } else {
             hMutex = xSemaphoreCreateMutex ();
           }
+          #endif
         }
       }
 
@@ -1398,7 +1422,9 @@ osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
           hSemaphore = xSemaphoreCreateBinaryStatic ((StaticSemaphore_t *)attr->cb_mem);
         }
         else {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
           hSemaphore = xSemaphoreCreateBinary();
+          #endif
         }
 
         if ((hSemaphore != NULL) && (initial_count != 0U)) {
@@ -1413,7 +1439,9 @@ osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, cons
           hSemaphore = xSemaphoreCreateCountingStatic (max_count, initial_count, (StaticSemaphore_t *)attr->cb_mem);
         }
         else {
+          #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
           hSemaphore = xSemaphoreCreateCounting (max_count, initial_count);
+          #endif
         }
       }
 
@@ -1575,7 +1603,9 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
     }
     else {
       if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         hQueue = xQueueCreate (msg_count, msg_size);
+        #endif
       }
     }
 
@@ -0,0 +1,52 @@
+/**
+ * @file    alarms.h
+ * @brief   On-device alarm rules evaluated on every sensor update
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __ALARMS_H
+#define __ALARMS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define ALARM_NUM_RULES 8
+
+/* Rule flags (ALARM_FIELD_FLAGS) */
+#define ALARM_FLAG_BELOW 0x0001  // Trip when value < threshold (default: > threshold)
+#define ALARM_FLAG_SIGNED 0x0002 // Source and threshold are int16 (e.g. °C x 100, delta mV)
+#define ALARM_FLAG_MASK (ALARM_FLAG_BELOW | ALARM_FLAG_SIGNED)
+
+/* Exported types ------------------------------------------------------------*/
+/* Holding registers of one rule, in Modbus order */
+typedef enum
+{
+    ALARM_FIELD_SOURCE = 0, // Modbus address of the watched register, 0 = rule disabled
+    ALARM_FIELD_FLAGS,      // ALARM_FLAG_*
+    ALARM_FIELD_THRESHOLD,  // Trip level, same units as the source register
+    ALARM_FIELD_HYSTERESIS, // Clear at threshold -/+ hysteresis
+    ALARM_FIELD_ON_DELAY,   // Condition must hold this long before the alarm sets (ms)
+    ALARM_FIELD_OFF_DELAY,  // Condition must be gone this long before it clears (ms)
+    ALARM_FIELD_COUNT
+} Alarm_Field_t;
+
+/* Exported functions --------------------------------------------------------*/
+void Alarms_Init(void);
+void Alarms_Evaluate(void);
+uint16_t Alarms_ReadRule(uint8_t rule, Alarm_Field_t field);
+HAL_StatusTypeDef Alarms_WriteRule(uint8_t rule, Alarm_Field_t field, uint16_t value);
+uint8_t Alarms_GetState(uint8_t rule);
+uint16_t Alarms_GetSummary(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ALARMS_H */
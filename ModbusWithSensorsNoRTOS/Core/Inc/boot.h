@@ -0,0 +1,47 @@
+/**
+ * @file    boot.h
+ * @brief   Boot milestones: when Modbus came up, answered and the sensors followed
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __BOOT_H
+#define __BOOT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Milestones, in Modbus order */
+typedef enum
+{
+    BOOT_MODBUS_ONLINE = 0, // USART1 receiving, requests are answered from here on
+    BOOT_FIRST_REPLY,       // First reply sent (time-to-first-response)
+    BOOT_MQ2_READY,         // ADC scan configured and calibrated
+    BOOT_SCD30_READY,       // SCD30 configuration read and measurement started
+    BOOT_MILESTONE_COUNT
+} Boot_Milestone_t;
+
+/* Registers per milestone, in Modbus order */
+typedef enum
+{
+    BOOT_REG_US_HI = 0, // Microseconds since HAL_Init() (32 bits, 0 = not reached yet)
+    BOOT_REG_US_LO,
+    BOOT_REG_COUNT
+} Boot_Reg_t;
+
+/* Exported functions --------------------------------------------------------*/
+void Boot_Mark(Boot_Milestone_t milestone);
+uint32_t Boot_GetTime(Boot_Milestone_t milestone);
+uint16_t Boot_ReadRegister(Boot_Milestone_t milestone, Boot_Reg_t reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_H */
@@ -0,0 +1,55 @@
+/**
+ * @file    history.h
+ * @brief   Compressed trend history of sensor updates with cursor retrieval
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __HISTORY_H
+#define __HISTORY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define HISTORY_NUM_BLOCKS 24    // Ring of blocks, the oldest block is dropped when full
+#define HISTORY_BLOCK_BYTES 128  // Encoded bytes per block (64 Modbus registers)
+#define HISTORY_NUM_FIELDS 12    // Registers stored per record (see history_fields)
+#define HISTORY_TIME_UNIT_MS 100 // Resolution of the record time deltas
+
+/* Exported types ------------------------------------------------------------*/
+/* History registers, in Modbus order */
+typedef enum
+{
+    HISTORY_REG_OLDEST_HI = 0, // Sequence number of the oldest stored record
+    HISTORY_REG_OLDEST_LO,
+    HISTORY_REG_NEXT_HI,       // Sequence number the next record will get
+    HISTORY_REG_NEXT_LO,
+    HISTORY_REG_CURSOR_HI,     // Requested record, R/W (write HI then LO)
+    HISTORY_REG_CURSOR_LO,
+    HISTORY_REG_BLOCK_SEQ_HI,  // Sequence number of the block's first record
+    HISTORY_REG_BLOCK_SEQ_LO,
+    HISTORY_REG_BLOCK_MS_HI,   // Uptime (ms) of the block's first record
+    HISTORY_REG_BLOCK_MS_LO,
+    HISTORY_REG_BLOCK_RECORDS, // Records in the block
+    HISTORY_REG_BLOCK_BYTES,   // Valid encoded bytes in the block
+    HISTORY_REG_DATA,          // Encoded bytes, big-endian pairs
+    HISTORY_REG_COUNT = HISTORY_REG_DATA + HISTORY_BLOCK_BYTES / 2
+} History_Reg_t;
+
+/* Exported functions --------------------------------------------------------*/
+void History_Init(void);
+void History_Append(void);
+uint16_t History_ReadRegister(uint16_t reg);
+HAL_StatusTypeDef History_WriteRegister(uint16_t reg, uint16_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HISTORY_H */
@@ -0,0 +1,31 @@
+/**
+ * @file    lowpower.h
+ * @brief   Sleep-on-idle for the main loop and sleep residency measurement
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __LOWPOWER_H
+#define __LOWPOWER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define LOWPOWER_ENABLE 1 // 0 = busy-spin when idle (e.g. while debugging sleep issues)
+
+/* Exported functions --------------------------------------------------------*/
+void LowPower_Init(void);
+void LowPower_Idle(void);
+uint16_t LowPower_GetResidency(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOWPOWER_H */
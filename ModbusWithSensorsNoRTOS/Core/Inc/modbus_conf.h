@@ -44,7 +44,8 @@ extern "C"
 // <q>  Use Modbus-ASCII
 #define STMODBUS_USE_ASCII 0
 // <q>  Use critical sections (recommended)
-#define STMODBUS_USE_CRITICAL_SECTIONS 0
+// <i> mbus_flush() from the main loop races the parser in the UART interrupt
+#define STMODBUS_USE_CRITICAL_SECTIONS 1
 // <o> Count modbus context
 // <i> Don't set a lot of count for memory saving
 #define STMODBUS_COUNT_CONTEXT 1
@@ -90,7 +91,13 @@ extern "C"
 
     //-------- <<< end of configuration section >>>    --------------------
 
+// Engine events go to the trace ring, stage stamps to the cycle histograms
+#define STMODBUS_TRACE_CRC_FAIL(func) TRACE(TRACE_EV_CRC_FAIL, (func))
+#define STMODBUS_PROF_MARK(point, func) MODBUS_PROF_MARK((point), (func))
+
 #include "mbutils.h"
+#include "modbus_prof.h"
+#include "trace.h"
 
 #ifdef _cplusplus
 }
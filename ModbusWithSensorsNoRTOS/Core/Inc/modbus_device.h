@@ -14,13 +14,75 @@ extern "C"
 
 #include "stdint.h"
 
+    /* Exported constants -------------------------------------------------------*/
+#define MODBUS_INPUT_REG_BASE 30001 // Input registers (FC04) - read-only diagnostics
+#define MODBUS_INPUT_REG_COUNT 7
+
+#define MODBUS_BOOT_BASE 30008 // Boot milestones (FC04): us since HAL_Init, 2 registers each
+#define MODBUS_BOOT_COUNT 8    // Modbus online, first reply, MQ2 ready, SCD30 ready
+
+#define MODBUS_SCD30_CFG_BASE 40101 // SCD30 configuration holding registers 40101-40108
+#define MODBUS_SCD30_CFG_COUNT 8
+
+#define MODBUS_MQ2_GAS_BASE 40201 // MQ2 Rs/R0, ppm, R0 and warm-up holding registers 40201-40233
+#define MODBUS_MQ2_GAS_COUNT 33
+
+#define MODBUS_MQ2_COMP_BASE 40301 // MQ2 temperature/humidity compensated values 40301-40318
+#define MODBUS_MQ2_COMP_COUNT 18
+
+#define MODBUS_ALARM_SUMMARY 40401    // Alarm summary: bits 0-7 active, bits 8-15 change counter
+#define MODBUS_ALARM_RULE_BASE 40402  // Alarm rules 40402-40449, ALARM_FIELD_COUNT registers each
+#define MODBUS_ALARM_RULE_COUNT 48
+
+#define MODBUS_DISCRETE_BASE 10001 // Discrete inputs (FC02) - alarm states 10001-10008
+#define MODBUS_DISCRETE_COUNT 8
+
+#define MODBUS_DIRTY_BASE 40501 // Change bitmaps of 40001-40020, 2 registers per master slot
+#define MODBUS_DIRTY_SLOTS 4     // Slot n at 40501 + 2n (bits 0-15) / 40502 + 2n (bits 16-19)
+#define MODBUS_DIRTY_COUNT (2 * MODBUS_DIRTY_SLOTS)
+
+#define MODBUS_BURST_BASE 40601 // MQ2 burst capture config/status 40601-40610 (data via FC20)
+#define MODBUS_BURST_COUNT 10
+
+#define MODBUS_HISTORY_BASE 40701 // Compressed history ring, cursor and block window 40701-40776
+#define MODBUS_HISTORY_COUNT 76
+
+#define MODBUS_STATS_CFG_BASE 40801 // Statistics window lengths (s) 40801-40803
+#define MODBUS_STATS_CFG_COUNT 3
+
+#define MODBUS_STATS_BASE 30101  // Statistics snapshots (FC04): window n at 30101 + 100n
+#define MODBUS_STATS_STRIDE 100  // Each block is STATS_REG_COUNT registers
+#define MODBUS_STATS_WINDOWS 3
+
+#define MODBUS_HEALTH_BASE 30401  // Sensor health records (FC04): SCD30, MQ2 CH0-CH3
+#define MODBUS_HEALTH_COUNT 45    // HEALTH_REG_COUNT registers per sensor
+#define MODBUS_QUALITY_BASE 30501 // Quality code of each of 40001-40015 (FC04)
+#define MODBUS_QUALITY_COUNT 15
+
+#define MODBUS_SCHED_BASE 30601 // Scheduler task records (FC04): MQ2, SCD30, publish, trend, diagnostics
+#define MODBUS_SCHED_COUNT 35   // SCHED_REG_COUNT registers per task
+
+#define MODBUS_PROF_BASE 30701   // Request path cycle histograms (FC04, MODBUS_PROF_ENABLE builds)
+#define MODBUS_PROF_COUNT 280    // MODBUS_PROF_REG_COUNT registers per histogram
+
+#define MODBUS_COIL_BASE 1 // Coils (FC01/FC05) - command triggers
+#define MODBUS_COIL_COUNT 9
+#define MODBUS_COIL_MQ2_CAL_ALL 5   // 00001-00004: calibrate R0 of CH0-CH3, 00005: all channels
+#define MODBUS_COIL_BURST_ARM 6     // 00006: ON = arm burst capture, OFF = disarm
+#define MODBUS_COIL_BURST_TRIG 7    // 00007: ON = trigger burst capture now
+#define MODBUS_COIL_TRACE_FREEZE 8  // 00008: ON = hold the event trace for FC20, OFF = resume
+#define MODBUS_COIL_PROF_RESET 9    // 00009: ON = clear the request path histograms
+
     /* Exported variables -------------------------------------------------------*/
     extern uint16_t device_registers[20];
+    extern uint16_t input_registers[MODBUS_INPUT_REG_COUNT];
 
     /* Exported functions -------------------------------------------------------*/
     uint16_t Modbus_Device_Read(uint32_t logical_address);
+    uint16_t Modbus_Device_ReadFile(uint16_t file, uint16_t record);
     uint16_t Modbus_Device_Write(uint32_t logical_address, uint16_t value);
     void Modbus_Device_UpdateSensors(void);
+    void Modbus_Device_UpdateDiagnostics(void);
     void Modbus_Device_SetRegister(uint8_t index, uint16_t value);
     uint16_t Modbus_Device_GetRegister(uint8_t index);
     void Modbus_Device_DebugArray(void);
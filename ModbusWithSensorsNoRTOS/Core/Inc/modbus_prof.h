@@ -0,0 +1,80 @@
+/**
+ * @file    modbus_prof.h
+ * @brief   DWT cycle-count histograms of the Modbus request path
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __MODBUS_PROF_H
+#define __MODBUS_PROF_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#ifndef MODBUS_PROF_ENABLE
+#define MODBUS_PROF_ENABLE 0 // 1 = time each request (560 B RAM); 0 = every stamp compiles out
+#endif
+
+#define MODBUS_PROF_BUCKETS 16 // Bucket 0 < 128 cycles, bucket n = 2^(n+6) to 2^(n+7) - 1, bucket 15 open
+
+/* Stamp points after the engine's MBUS_PROF_* (modbus.h) */
+#define MODBUS_PROF_RX (MBUS_PROF_POINTS + 0)       // USART1 idle line interrupt entered
+#define MODBUS_PROF_TX_START (MBUS_PROF_POINTS + 1) // First reply byte about to go to USART1
+#define MODBUS_PROF_TX_DONE (MBUS_PROF_POINTS + 2)  // Modbus_SendData() finished
+#define MODBUS_PROF_POINT_COUNT (MBUS_PROF_POINTS + 3)
+
+/* Exported types ------------------------------------------------------------*/
+/* Histograms, in Modbus order */
+typedef enum
+{
+    MODBUS_PROF_TURNAROUND = 0, // Idle line interrupt to first reply byte
+    MODBUS_PROF_PARSE,          // mbus_poll() over the frame, CRC check included
+    MODBUS_PROF_CRC,            // Reply CRC
+    MODBUS_PROF_SEND,           // Modbus_SendData() (blocking transmit, wire time included)
+    MODBUS_PROF_FC01,           // mbus_poll_response() per function code
+    MODBUS_PROF_FC02,
+    MODBUS_PROF_FC03,
+    MODBUS_PROF_FC04,
+    MODBUS_PROF_FC05,
+    MODBUS_PROF_FC06,
+    MODBUS_PROF_FC15,
+    MODBUS_PROF_FC16,
+    MODBUS_PROF_FC20,
+    MODBUS_PROF_FC_OTHER,
+    MODBUS_PROF_HIST_COUNT
+} ModbusProf_Hist_t;
+
+/* Registers of one histogram, in Modbus order */
+typedef enum
+{
+    MODBUS_PROF_REG_COUNT_HI = 0, // Samples since the last reset (32 bits)
+    MODBUS_PROF_REG_COUNT_LO,
+    MODBUS_PROF_REG_MAX_HI, // Longest sample (cycles, 32 bits)
+    MODBUS_PROF_REG_MAX_LO,
+    MODBUS_PROF_REG_BUCKETS, // Samples per bucket (saturate at 65535)
+    MODBUS_PROF_REG_COUNT = MODBUS_PROF_REG_BUCKETS + MODBUS_PROF_BUCKETS
+} ModbusProf_Reg_t;
+
+/* Exported macros -----------------------------------------------------------*/
+#if MODBUS_PROF_ENABLE
+#define MODBUS_PROF_MARK(point, func) ModbusProf_Mark((point), (func))
+#else
+#define MODBUS_PROF_MARK(point, func) ((void)0)
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+void ModbusProf_Mark(uint8_t point, uint8_t func);
+void ModbusProf_Reset(void);
+uint16_t ModbusProf_ReadRegister(ModbusProf_Hist_t hist, ModbusProf_Reg_t reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MODBUS_PROF_H */
@@ -0,0 +1,76 @@
+/**
+ * @file    mq2_burst.h
+ * @brief   High-rate MQ2 waveform capture with pre/post-trigger windows
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __MQ2_BURST_H
+#define __MQ2_BURST_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sensors.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define MQ2_BURST_DEPTH 500           // Samples per channel (4 x 500 x 2 B = CCM RAM)
+#define MQ2_BURST_RATE_MIN_HZ 10
+#define MQ2_BURST_RATE_MAX_HZ 5000    // Six-rank scan takes ~36 us at 32 MHz ADC clock
+#define MQ2_BURST_TIMER_HZ 100000     // TIM6 counter clock after prescaler
+#define MQ2_BURST_IRQ_PRIORITY 1      // Below UART/DMA so Modbus timing is unaffected
+
+/* FC20 file numbers */
+#define MQ2_BURST_FILE_HEADER 0 // Records 0-9 mirror the status/config registers
+#define MQ2_BURST_FILE_CH0 1    // Files 1-4: CH0-CH3 raw ADC counts, record 0 = oldest
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+    MQ2_BURST_IDLE = 0, // Not sampling
+    MQ2_BURST_ARMED,    // Filling the pre-trigger ring, waiting for a trigger
+    MQ2_BURST_TRIGGERED, // Recording the post-trigger window
+    MQ2_BURST_FROZEN    // Capture complete, readable through FC20
+} MQ2_BurstState_t;
+
+/* Burst registers, in Modbus order */
+typedef enum
+{
+    MQ2_BURST_REG_RATE = 0,    // Sample rate (Hz), R/W
+    MQ2_BURST_REG_PRE_MS,      // Pre-trigger window (ms), R/W
+    MQ2_BURST_REG_POST_MS,     // Post-trigger window (ms), R/W
+    MQ2_BURST_REG_ALARM_MASK,  // Alarm rules that trigger a capture, R/W
+    MQ2_BURST_REG_STATE,       // MQ2_BurstState_t
+    MQ2_BURST_REG_SAMPLES,     // Samples per channel in the frozen capture
+    MQ2_BURST_REG_TRIGGER_IDX, // Record number of the first post-trigger sample
+    MQ2_BURST_REG_ACTUAL_RATE, // Rate after timer rounding (Hz)
+    MQ2_BURST_REG_CAPTURES,    // Completed captures (wraps)
+    MQ2_BURST_REG_OVERRUNS,    // Timer ticks dropped because the ADC was busy
+    MQ2_BURST_REG_COUNT
+} MQ2_BurstReg_t;
+
+/* Exported variables --------------------------------------------------------*/
+extern TIM_HandleTypeDef htim6; // Burst sample clock
+
+/* Exported functions --------------------------------------------------------*/
+void MQ2_Burst_Init(void);
+HAL_StatusTypeDef MQ2_Burst_Arm(void);
+void MQ2_Burst_Disarm(void);
+void MQ2_Burst_Trigger(void);
+void MQ2_Burst_CheckAlarms(uint8_t active_mask);
+uint8_t MQ2_Burst_IsSampling(void);
+void MQ2_Burst_TimerTick(void);
+void MQ2_Burst_OnScan(const uint16_t *scan);
+uint16_t MQ2_Burst_ReadRegister(MQ2_BurstReg_t reg);
+HAL_StatusTypeDef MQ2_Burst_WriteRegister(MQ2_BurstReg_t reg, uint16_t value);
+HAL_StatusTypeDef MQ2_Burst_ReadRecord(uint16_t file, uint16_t record, uint16_t *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MQ2_BURST_H */
@@ -0,0 +1,69 @@
+/**
+ * @file    sched.h
+ * @brief   Cooperative earliest-deadline-first task scheduler
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Time base, supplied by the caller so the core also runs on a virtual clock */
+typedef struct
+{
+    uint32_t (*now_ms)(void);     // Release/deadline time base (wraps)
+    uint32_t (*now_cycles)(void); // Execution time counter (wraps)
+    uint32_t cycles_per_us;
+} Sched_Clock_t;
+
+/* One periodic task. The caller fills the first block, the scheduler the rest. */
+typedef struct
+{
+    void (*run)(void);
+    uint32_t period_ms;
+    uint32_t phase_ms;    // Offset of the first release from Sched_Init
+    uint32_t deadline_ms; // Relative deadline, 0 = end of the period
+
+    uint32_t release;     // Tick of the pending release
+    uint32_t runs;
+    uint16_t last_us;     // Execution time of the latest run (saturated)
+    uint16_t wcet_us;     // Longest execution time seen
+    uint16_t max_late_ms; // Longest delay from release to start
+    uint16_t overruns;    // Runs that finished after their deadline
+    uint16_t skipped;     // Releases dropped because their deadline had passed
+    volatile uint8_t requested; // Extra run asked for with Sched_Request
+} Sched_Task_t;
+
+/* Registers of one task record, in Modbus order */
+typedef enum
+{
+    SCHED_REG_PERIOD_MS = 0, // Configured period
+    SCHED_REG_RUNS,          // Completed runs (low 16 bits)
+    SCHED_REG_LAST_US,       // Execution time of the latest run
+    SCHED_REG_WCET_US,       // Worst-case execution time since boot (65535 = saturated)
+    SCHED_REG_MAX_LATE_MS,   // Worst release-to-start delay
+    SCHED_REG_OVERRUNS,      // Deadline misses
+    SCHED_REG_SKIPPED,       // Releases dropped after a miss
+    SCHED_REG_COUNT
+} Sched_Reg_t;
+
+/* Exported functions --------------------------------------------------------*/
+void Sched_Init(Sched_Task_t *tasks, uint8_t count, const Sched_Clock_t *clock);
+uint8_t Sched_RunNext(void);
+void Sched_SetPeriod(uint8_t task, uint32_t period_ms);
+void Sched_Request(uint8_t task);
+uint16_t Sched_ReadRegister(uint8_t task, Sched_Reg_t reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCHED_H */
@@ -0,0 +1,28 @@
+/**
+ * @file    sensors_conf.h
+ * @brief   stSensors configuration for ModbusWithSensorsNoRTOS
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __SENSORS_CONF_H
+#define __SENSORS_CONF_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "boot.h"
+#include "tasks.h"
+#include "trace.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SENSORS_USE_BURST 1 // MQ2 burst capture (mq2_burst.c, TIM6) shares the ADC scan
+
+/* Sensor events go to the trace ring, bring-up to the boot milestones */
+#define SENSORS_TRACE_I2C_START(arg) TRACE(TRACE_EV_I2C_START, (arg))
+#define SENSORS_TRACE_I2C_END(res) TRACE(TRACE_EV_I2C_END, (res))
+#define SENSORS_TRACE_ADC_FRAME(burst) TRACE(TRACE_EV_ADC_FRAME, (burst))
+#define SENSORS_ON_MQ2_STARTED() Boot_Mark(BOOT_MQ2_READY)
+#define SENSORS_ON_SCD30_STARTED() Boot_Mark(BOOT_SCD30_READY)
+
+/* The SCD30 task polls once per measurement interval */
+#define SENSORS_ON_SCD30_INTERVAL(seconds) Sched_SetPeriod(TASK_SCD30, (uint32_t)(seconds) * 1000UL)
+
+#endif /* __SENSORS_CONF_H */
@@ -0,0 +1,60 @@
+/**
+ * @file    stats.h
+ * @brief   Sliding-window min/max/mean/stddev per sensor channel
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __STATS_H
+#define __STATS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define STATS_NUM_WINDOWS 3  // Independent window lengths
+#define STATS_NUM_CHANNELS 7 // MQ2 CH0-CH3 mV, CO2, temperature, humidity
+#define STATS_BUCKETS 5      // Sub-intervals per window; the window slides by one bucket
+
+#define STATS_WINDOW_MIN_S 5
+#define STATS_WINDOW_MAX_S 36000 // Keeps the per-window sample count within 16 bits
+#define STATS_DEFAULT_WINDOWS_S {10, 60, 600}
+
+/* Exported types ------------------------------------------------------------*/
+/* Snapshot registers of one window, in Modbus order */
+typedef enum
+{
+    STATS_REG_WINDOW_S = 0, // Window length the snapshot was taken with (s)
+    STATS_REG_SAMPLES,      // Samples in the window (channel with the most good readings)
+    STATS_REG_UPDATES,      // Snapshot counter (wraps); changes when the window slides
+    STATS_REG_CHANNELS,     // Per channel: mean, stddev, min, max
+    STATS_REG_COUNT = STATS_REG_CHANNELS + 4 * STATS_NUM_CHANNELS
+} Stats_Reg_t;
+
+/* Per-channel snapshot fields, in Modbus order */
+typedef enum
+{
+    STATS_FIELD_MEAN = 0, // Source register units (int16_t for temperature)
+    STATS_FIELD_STDDEV,   // Population standard deviation, source units
+    STATS_FIELD_MIN,
+    STATS_FIELD_MAX,
+    STATS_FIELD_COUNT
+} Stats_Field_t;
+
+/* Exported functions --------------------------------------------------------*/
+void Stats_Init(void);
+void Stats_Update(void);
+uint16_t Stats_ReadSnapshot(uint8_t window, uint16_t reg);
+uint16_t Stats_GetWindow(uint8_t window);
+HAL_StatusTypeDef Stats_SetWindow(uint8_t window, uint16_t seconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STATS_H */
@@ -0,0 +1,39 @@
+/**
+ * @file    tasks.h
+ * @brief   Periodic application tasks run by the cooperative scheduler
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __TASKS_H
+#define __TASKS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sched.h"
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Tasks, in Modbus order (one SCHED_REG_COUNT record each) */
+typedef enum
+{
+    TASK_MQ2 = 0, // MQ2 scan, gas model and compensation
+    TASK_SCD30,   // SCD30 pending settings and data-ready polling
+    TASK_PUBLISH, // Map values to 40001-40018, change bitmaps, alarms, burst trigger
+    TASK_TREND,   // History ring and windowed statistics
+    TASK_DIAG,    // Diagnostic input registers 30001-30007
+    TASK_COUNT
+} Task_Id_t;
+
+/* Exported functions --------------------------------------------------------*/
+void Tasks_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TASKS_H */
@@ -0,0 +1,85 @@
+/**
+ * @file    trace.h
+ * @brief   In-RAM binary event trace with DWT cycle timestamps
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define TRACE_ENABLE 1   // 0 = compile every TRACE() out and answer FC20 trace files with exception 02
+#define TRACE_DEPTH 128  // Records in the ring (power of two, 8 B each)
+
+/* FC20 file numbers (after the MQ2 burst files 0-4) */
+#define TRACE_FILE_HEADER 16  // Records 0-7: TRACE_REG_*
+#define TRACE_FILE_RECORDS 17 // 4 registers per event, record 0 = oldest event
+
+#define TRACE_MAGIC 0x5452 // "TR"
+#define TRACE_VERSION 1
+
+/* Exported types ------------------------------------------------------------*/
+/* Event ids; the decoder (tools/trace_decode.py) keeps the same list */
+typedef enum
+{
+    TRACE_EV_FRAME_RX = 1, // Idle line ended a frame; arg = bytes
+    TRACE_EV_CRC_FAIL,     // Frame dropped on CRC; arg = function code
+    TRACE_EV_RESPONSE,     // Reply left the UART; arg = function (bit 7 = exception) << 8 | bytes
+    TRACE_EV_UART_ERROR,   // USART1 error; arg = HAL error code
+    TRACE_EV_I2C_START,    // SCD30 transfer started; arg = bytes, bit 15 = read
+    TRACE_EV_I2C_END,      // SCD30 transfer finished; arg = HAL status
+    TRACE_EV_ADC_FRAME,    // ADC DMA scan complete; arg = 1 for a burst scan
+    TRACE_EV_BOOT,         // Boot milestone first reached; arg = Boot_Milestone_t
+    TRACE_EV_COUNT
+} Trace_Event_t;
+
+/* Header registers, FC20 file TRACE_FILE_HEADER */
+typedef enum
+{
+    TRACE_REG_MAGIC = 0, // TRACE_MAGIC
+    TRACE_REG_VERSION,   // TRACE_VERSION
+    TRACE_REG_DEPTH,     // TRACE_DEPTH
+    TRACE_REG_COUNT_HI,  // Events recorded since boot (32 bits, wraps)
+    TRACE_REG_COUNT_LO,
+    TRACE_REG_VALID,     // Records readable from TRACE_FILE_RECORDS
+    TRACE_REG_CLOCK_KHZ, // DWT clock (core clock, kHz)
+    TRACE_REG_FROZEN,    // 1 while coil 00008 holds the ring
+    TRACE_REG_COUNT
+} Trace_Reg_t;
+
+/* One event, 8 bytes */
+typedef struct
+{
+    uint32_t cycles; // DWT->CYCCNT when recorded
+    uint16_t id;     // Trace_Event_t
+    uint16_t arg;
+} Trace_Record_t;
+
+/* Exported macros -----------------------------------------------------------*/
+#if TRACE_ENABLE
+#define TRACE(id, arg) Trace_Record((id), (arg))
+#else
+#define TRACE(id, arg) ((void)0)
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+void Trace_Init(void);
+void Trace_Record(uint16_t id, uint16_t arg);
+void Trace_Freeze(uint8_t frozen);
+uint8_t Trace_IsFrozen(void);
+HAL_StatusTypeDef Trace_ReadRecord(uint16_t file, uint16_t record, uint16_t *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TRACE_H */
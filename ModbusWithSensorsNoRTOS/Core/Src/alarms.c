@@ -0,0 +1,199 @@
+/**
+ * @file    alarms.c
+ * @brief   On-device alarm rules evaluated on every sensor update
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * A rule watches any readable Modbus register (by its logical address, e.g.
+ * 40305 = MQ2 CH0 corrected LPG ppm, 40013 = CO2) and compares it against a
+ * threshold with hysteresis. The result is debounced by an on-delay and an
+ * off-delay before it reaches the alarm state, which the master reads as a
+ * discrete input or through the summary register.
+ */
+
+#include "alarms.h"
+#include "modbus_device.h"
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+    uint8_t condition; // Threshold comparison result, with hysteresis
+    uint8_t active;    // Debounced alarm output
+    uint32_t since;    // Tick when condition last differed from active
+} Alarm_State_t;
+
+/* Private variables ---------------------------------------------------------*/
+// Rule table, written by the Modbus ISR and read by the main loop
+static uint16_t alarm_rules[ALARM_NUM_RULES][ALARM_FIELD_COUNT];
+static Alarm_State_t alarm_state[ALARM_NUM_RULES];
+
+static volatile uint8_t alarm_dirty;   // Bit n: rule n changed, restart its state
+static volatile uint8_t alarm_active;  // Bit n: rule n in alarm
+static volatile uint8_t alarm_changes; // Incremented on every alarm set/clear
+
+/* Private function prototypes -----------------------------------------------*/
+static void Alarms_EvaluateRule(uint8_t rule, uint32_t now);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Evaluate one rule against its source register
+ * @param  rule: Rule index
+ * @param  now: Current tick (ms)
+ * @retval None
+ */
+static void Alarms_EvaluateRule(uint8_t rule, uint32_t now)
+{
+    const uint16_t *r = alarm_rules[rule];
+    Alarm_State_t *st = &alarm_state[rule];
+
+    int32_t value = Modbus_Device_Read(r[ALARM_FIELD_SOURCE]);
+    int32_t threshold = r[ALARM_FIELD_THRESHOLD];
+    int32_t hysteresis = r[ALARM_FIELD_HYSTERESIS];
+
+    if (r[ALARM_FIELD_FLAGS] & ALARM_FLAG_SIGNED)
+    {
+        value = (int16_t)value;
+        threshold = (int16_t)threshold;
+    }
+
+    // Trip beyond the threshold, clear only once back past the hysteresis band
+    if (r[ALARM_FIELD_FLAGS] & ALARM_FLAG_BELOW)
+    {
+        if (value < threshold)
+            st->condition = 1;
+        else if (value > threshold + hysteresis)
+            st->condition = 0;
+    }
+    else
+    {
+        if (value > threshold)
+            st->condition = 1;
+        else if (value < threshold - hysteresis)
+            st->condition = 0;
+    }
+
+    if (st->condition == st->active)
+    {
+        st->since = now;
+        return;
+    }
+
+    uint32_t delay = st->condition ? r[ALARM_FIELD_ON_DELAY] : r[ALARM_FIELD_OFF_DELAY];
+    if ((now - st->since) >= delay)
+    {
+        st->active = st->condition;
+        st->since = now;
+        alarm_changes++;
+    }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Clear all rules (all disabled)
+ * @param  None
+ * @retval None
+ */
+void Alarms_Init(void)
+{
+    memset(alarm_rules, 0, sizeof(alarm_rules));
+    memset(alarm_state, 0, sizeof(alarm_state));
+    alarm_dirty = 0;
+    alarm_active = 0;
+    alarm_changes = 0;
+}
+
+/**
+ * @brief  Evaluate all enabled rules (call after the registers are refreshed)
+ * @param  None
+ * @retval None
+ */
+void Alarms_Evaluate(void)
+{
+    uint32_t now = HAL_GetTick();
+    uint8_t active = 0;
+
+    __disable_irq();
+    uint8_t dirty = alarm_dirty;
+    alarm_dirty = 0;
+    __enable_irq();
+
+    for (uint8_t i = 0; i < ALARM_NUM_RULES; i++)
+    {
+        if (dirty & (1U << i))
+        {
+            // Reconfigured rule starts from a clean state; report a cleared alarm
+            if (alarm_state[i].active)
+                alarm_changes++;
+            memset(&alarm_state[i], 0, sizeof(alarm_state[i]));
+            alarm_state[i].since = now;
+        }
+
+        if (alarm_rules[i][ALARM_FIELD_SOURCE] == 0)
+            continue;
+
+        Alarms_EvaluateRule(i, now);
+        if (alarm_state[i].active)
+            active |= (uint8_t)(1U << i);
+    }
+
+    alarm_active = active;
+}
+
+/**
+ * @brief  Read one rule register
+ * @param  rule: Rule index (0 to ALARM_NUM_RULES-1)
+ * @param  field: Register within the rule
+ * @retval Register value
+ */
+uint16_t Alarms_ReadRule(uint8_t rule, Alarm_Field_t field)
+{
+    if (rule >= ALARM_NUM_RULES || field >= ALARM_FIELD_COUNT)
+        return 0;
+    return alarm_rules[rule][field];
+}
+
+/**
+ * @brief  Write one rule register (from the Modbus ISR)
+ * @param  rule: Rule index (0 to ALARM_NUM_RULES-1)
+ * @param  field: Register within the rule
+ * @param  value: New value
+ * @retval HAL_ERROR if the value is not valid for the field
+ */
+HAL_StatusTypeDef Alarms_WriteRule(uint8_t rule, Alarm_Field_t field, uint16_t value)
+{
+    if (rule >= ALARM_NUM_RULES || field >= ALARM_FIELD_COUNT)
+        return HAL_ERROR;
+
+    if (field == ALARM_FIELD_FLAGS && (value & ~ALARM_FLAG_MASK))
+        return HAL_ERROR;
+
+    alarm_rules[rule][field] = value;
+    alarm_dirty |= (uint8_t)(1U << rule);
+    return HAL_OK;
+}
+
+/**
+ * @brief  Get debounced alarm state of one rule
+ * @param  rule: Rule index
+ * @retval 1 = in alarm, 0 = normal or disabled
+ */
+uint8_t Alarms_GetState(uint8_t rule)
+{
+    if (rule >= ALARM_NUM_RULES)
+        return 0;
+    return (alarm_active >> rule) & 1U;
+}
+
+/**
+ * @brief  Get the summary register
+ * @param  None
+ * @retval Bits 0-7: active rules, bits 8-15: change counter (wraps)
+ * @note   The counter lets a master polling only this register notice an
+ *         alarm that set and cleared again between two polls.
+ */
+uint16_t Alarms_GetSummary(void)
+{
+    return (uint16_t)(alarm_active | ((uint16_t)alarm_changes << 8));
+}
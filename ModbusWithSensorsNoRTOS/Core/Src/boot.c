@@ -0,0 +1,100 @@
+/**
+ * @file    boot.c
+ * @brief   Boot milestones: when Modbus came up, answered and the sensors followed
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * Modbus is started before the sensors are brought up, so the slave answers
+ * within a millisecond or so of reset while the ADC and the SCD30 are still
+ * being started from the main loop. Each milestone keeps the time it was
+ * first reached, in microseconds from HAL_Init(): the HAL tick plus the
+ * SysTick down-counter, so no timer is spent on it. The first mark is also
+ * logged to the event trace, whose DWT timestamps run undisturbed from
+ * Trace_Init(), so the milestones can be lined up with the requests and
+ * sensor transfers around them.
+ */
+
+#include "boot.h"
+#include "trace.h"
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t boot_us[BOOT_MILESTONE_COUNT]; // 0 = not reached yet
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Microseconds since HAL_Init() (any context)
+ * @param  None
+ * @retval Time in us, saturates after about 71 minutes
+ */
+static uint32_t Boot_Now(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t ms = HAL_GetTick();
+    uint32_t val = SysTick->VAL;
+
+    // SysTick wrapped but its interrupt has not run yet (masked or lower priority)
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+    {
+        val = SysTick->VAL;
+        ms++;
+    }
+
+    __set_PRIMASK(primask);
+
+    uint32_t load = SysTick->LOAD + 1;
+    if (ms >= 0xFFFFFFFFUL / 1000)
+        return 0xFFFFFFFFUL;
+    return ms * 1000 + ((load - 1 - val) * 1000) / load;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Record that a milestone was reached (any context, first call counts)
+ * @param  milestone: Milestone
+ * @retval None
+ */
+void Boot_Mark(Boot_Milestone_t milestone)
+{
+    if (milestone >= BOOT_MILESTONE_COUNT || boot_us[milestone] != 0)
+        return;
+
+    uint32_t us = Boot_Now();
+    boot_us[milestone] = (us != 0) ? us : 1; // Keep 0 for "not reached"
+    TRACE(TRACE_EV_BOOT, milestone);
+}
+
+/**
+ * @brief  Time a milestone was reached
+ * @param  milestone: Milestone
+ * @retval Microseconds since HAL_Init(), 0 if not reached yet
+ */
+uint32_t Boot_GetTime(Boot_Milestone_t milestone)
+{
+    if (milestone >= BOOT_MILESTONE_COUNT)
+        return 0;
+    return boot_us[milestone];
+}
+
+/**
+ * @brief  Read one milestone register (Modbus ISR)
+ * @param  milestone: Milestone
+ * @param  reg: Register within the milestone
+ * @retval Register value
+ */
+uint16_t Boot_ReadRegister(Boot_Milestone_t milestone, Boot_Reg_t reg)
+{
+    uint32_t us = Boot_GetTime(milestone);
+
+    switch (reg)
+    {
+    case BOOT_REG_US_HI:
+        return (uint16_t)(us >> 16);
+    case BOOT_REG_US_LO:
+        return (uint16_t)us;
+    default:
+        return 0;
+    }
+}
@@ -0,0 +1,312 @@
+/**
+ * @file    history.c
+ * @brief   Compressed trend history of sensor updates with cursor retrieval
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * Every sensor update appends one record to a ring of fixed-size blocks.
+ * A record is
+ *
+ *   varint  time since the previous record (HISTORY_TIME_UNIT_MS units)
+ *   varint  bitmask of fields that changed (bit n = history_fields[n])
+ *   varint  zig-zag(new - previous) for each changed field, lowest bit first
+ *
+ * Each block decodes on its own: the previous values start at zero and the
+ * first record's time is the block time, so the first record carries the
+ * absolute values. When the ring is full the oldest block is dropped whole.
+ *
+ * A master writes a record sequence number to the cursor and reads the block
+ * holding it; the block header tells where the next read should continue.
+ */
+
+#include "history.h"
+#include "modbus_device.h"
+#include <string.h>
+
+/* Private constants ---------------------------------------------------------*/
+#define HISTORY_MAX_RECORD (5 + 3 + 3 * HISTORY_NUM_FIELDS) // Worst-case record size
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t first_seq; // Sequence number of the first record
+    uint32_t first_ms;  // Uptime of the first record
+    uint16_t records;   // Records stored
+    uint8_t used;       // Encoded bytes stored
+    uint8_t data[HISTORY_BLOCK_BYTES];
+} History_Block_t;
+
+/* Private variables ---------------------------------------------------------*/
+// Recorded registers. Fields that change on most updates come first, so the
+// change mask usually fits one varint byte.
+static const uint16_t history_fields[HISTORY_NUM_FIELDS] = {
+    40001, 40002, 40003, 40004, // MQ2 CH0-CH3 raw ADC
+    40013, 40014, 40015,        // CO2, temperature, humidity
+    40009, 40010, 40011, 40012, // MQ2 CH0-CH3 digital
+    40401};                     // Alarm summary
+
+static History_Block_t history_blocks[HISTORY_NUM_BLOCKS];
+static uint8_t history_head;      // Block being filled
+static uint8_t history_used;      // Blocks holding records
+static uint32_t history_next_seq; // Sequence number of the next record
+
+// Encoder state, main loop only
+static uint16_t history_prev[HISTORY_NUM_FIELDS];
+static uint32_t history_prev_ms;
+
+// Cursor state, Modbus ISR only
+static uint16_t history_cursor_hi;
+static uint32_t history_cursor;
+static int8_t history_sel = -1; // Block selected by the cursor
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t History_PutVarint(uint8_t *dst, uint32_t value);
+static uint8_t History_Encode(uint8_t *dst, const uint16_t *values, uint32_t now);
+static void History_StartBlock(uint32_t now);
+static void History_Select(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Write an unsigned LEB128 varint
+ * @param  dst: Destination (at least 5 bytes)
+ * @param  value: Value to encode
+ * @retval Bytes written
+ */
+static uint8_t History_PutVarint(uint8_t *dst, uint32_t value)
+{
+    uint8_t len = 0;
+
+    while (value >= 0x80)
+    {
+        dst[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    dst[len++] = (uint8_t)value;
+    return len;
+}
+
+/**
+ * @brief  Encode one record against the encoder state
+ * @param  dst: Destination (HISTORY_MAX_RECORD bytes)
+ * @param  values: Field values
+ * @param  now: Current tick (ms)
+ * @retval Bytes written
+ */
+static uint8_t History_Encode(uint8_t *dst, const uint16_t *values, uint32_t now)
+{
+    uint32_t dt = (now - history_prev_ms) / HISTORY_TIME_UNIT_MS;
+    uint16_t mask = 0;
+    uint8_t len;
+
+    for (uint8_t i = 0; i < HISTORY_NUM_FIELDS; i++)
+    {
+        if (values[i] != history_prev[i])
+            mask |= (uint16_t)(1U << i);
+    }
+
+    len = History_PutVarint(dst, dt);
+    len += History_PutVarint(dst + len, mask);
+
+    for (uint8_t i = 0; i < HISTORY_NUM_FIELDS; i++)
+    {
+        if (!(mask & (1U << i)))
+            continue;
+
+        // Deltas wrap modulo 2^16, so every register value round-trips
+        int16_t delta = (int16_t)(values[i] - history_prev[i]);
+        uint16_t zigzag = (uint16_t)(((uint16_t)delta << 1) ^ (uint16_t)(delta >> 15));
+        len += History_PutVarint(dst + len, zigzag);
+    }
+    return len;
+}
+
+/**
+ * @brief  Open the next block, dropping the oldest one if the ring is full
+ * @param  now: Current tick (ms), becomes the block time
+ * @retval None
+ */
+static void History_StartBlock(uint32_t now)
+{
+    // The Modbus ISR may be reading this block; switch it over atomically
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (history_used > 0)
+        history_head = (history_head + 1) % HISTORY_NUM_BLOCKS;
+    if (history_used < HISTORY_NUM_BLOCKS)
+        history_used++;
+
+    History_Block_t *blk = &history_blocks[history_head];
+    blk->first_seq = history_next_seq;
+    blk->first_ms = now;
+    blk->records = 0;
+    blk->used = 0;
+    memset(blk->data, 0, sizeof(blk->data));
+
+    __set_PRIMASK(primask);
+
+    // First record of a block is encoded against zero at the block time
+    memset(history_prev, 0, sizeof(history_prev));
+    history_prev_ms = now;
+}
+
+/**
+ * @brief  Select the block holding the cursor record (Modbus ISR)
+ * @param  None
+ * @retval None
+ * @note   A cursor older than the ring selects the oldest block; the master
+ *         sees the gap from the block's first sequence number.
+ */
+static void History_Select(void)
+{
+    history_sel = -1;
+
+    for (uint8_t i = 0; i < history_used; i++)
+    {
+        uint8_t b = (history_head + HISTORY_NUM_BLOCKS - i) % HISTORY_NUM_BLOCKS;
+        history_sel = (int8_t)b;
+        if (history_cursor >= history_blocks[b].first_seq)
+            break;
+    }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Clear the history
+ * @param  None
+ * @retval None
+ */
+void History_Init(void)
+{
+    memset(history_blocks, 0, sizeof(history_blocks));
+    history_head = 0;
+    history_used = 0;
+    history_next_seq = 0;
+    history_cursor_hi = 0;
+    history_cursor = 0;
+    history_sel = -1;
+}
+
+/**
+ * @brief  Append the current register values (call after each sensor update)
+ * @param  None
+ * @retval None
+ */
+void History_Append(void)
+{
+    uint16_t values[HISTORY_NUM_FIELDS];
+    uint8_t rec[HISTORY_MAX_RECORD];
+    uint32_t now = HAL_GetTick();
+
+    for (uint8_t i = 0; i < HISTORY_NUM_FIELDS; i++)
+    {
+        values[i] = Modbus_Device_Read(history_fields[i]);
+    }
+
+    History_Block_t *blk = &history_blocks[history_head];
+    uint8_t len = 0;
+
+    if (history_used > 0)
+    {
+        len = History_Encode(rec, values, now);
+    }
+    if (history_used == 0 || blk->used + len > HISTORY_BLOCK_BYTES)
+    {
+        History_StartBlock(now);
+        blk = &history_blocks[history_head];
+        len = History_Encode(rec, values, now);
+    }
+
+    // Bytes past 'used' are invisible to readers until the counts move
+    memcpy(&blk->data[blk->used], rec, len);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    blk->used += len;
+    blk->records++;
+    history_next_seq++;
+    __set_PRIMASK(primask);
+
+    memcpy(history_prev, values, sizeof(history_prev));
+    history_prev_ms += (now - history_prev_ms) / HISTORY_TIME_UNIT_MS * HISTORY_TIME_UNIT_MS;
+}
+
+/**
+ * @brief  Read a history register (Modbus ISR)
+ * @param  reg: Offset from the first history register
+ * @retval Register value
+ * @note   Reading HISTORY_REG_BLOCK_SEQ_HI re-selects the cursor block, so read
+ *         the block header and data in one request.
+ */
+uint16_t History_ReadRegister(uint16_t reg)
+{
+    uint32_t oldest = history_next_seq;
+    if (history_used > 0)
+    {
+        oldest = history_blocks[(history_head + HISTORY_NUM_BLOCKS + 1 - history_used) % HISTORY_NUM_BLOCKS].first_seq;
+    }
+
+    if (reg == HISTORY_REG_BLOCK_SEQ_HI)
+        History_Select();
+
+    const History_Block_t *blk = (history_sel >= 0) ? &history_blocks[history_sel] : NULL;
+
+    switch (reg)
+    {
+    case HISTORY_REG_OLDEST_HI:
+        return (uint16_t)(oldest >> 16);
+    case HISTORY_REG_OLDEST_LO:
+        return (uint16_t)oldest;
+    case HISTORY_REG_NEXT_HI:
+        return (uint16_t)(history_next_seq >> 16);
+    case HISTORY_REG_NEXT_LO:
+        return (uint16_t)history_next_seq;
+    case HISTORY_REG_CURSOR_HI:
+        return (uint16_t)(history_cursor >> 16);
+    case HISTORY_REG_CURSOR_LO:
+        return (uint16_t)history_cursor;
+    case HISTORY_REG_BLOCK_SEQ_HI:
+        return blk ? (uint16_t)(blk->first_seq >> 16) : (uint16_t)(history_next_seq >> 16);
+    case HISTORY_REG_BLOCK_SEQ_LO:
+        return blk ? (uint16_t)blk->first_seq : (uint16_t)history_next_seq;
+    case HISTORY_REG_BLOCK_MS_HI:
+        return blk ? (uint16_t)(blk->first_ms >> 16) : 0;
+    case HISTORY_REG_BLOCK_MS_LO:
+        return blk ? (uint16_t)blk->first_ms : 0;
+    case HISTORY_REG_BLOCK_RECORDS:
+        return blk ? blk->records : 0;
+    case HISTORY_REG_BLOCK_BYTES:
+        return blk ? blk->used : 0;
+    default:
+        break;
+    }
+
+    if (!blk || reg >= HISTORY_REG_COUNT)
+        return 0;
+
+    uint16_t i = (uint16_t)(reg - HISTORY_REG_DATA) * 2;
+    return (uint16_t)((blk->data[i] << 8) | blk->data[i + 1]);
+}
+
+/**
+ * @brief  Write a history register (Modbus ISR); only the cursor is writable
+ * @param  reg: Offset from the first history register
+ * @param  value: New value
+ * @retval HAL_ERROR for read-only registers
+ */
+HAL_StatusTypeDef History_WriteRegister(uint16_t reg, uint16_t value)
+{
+    switch (reg)
+    {
+    case HISTORY_REG_CURSOR_HI:
+        history_cursor_hi = value; // Takes effect with the LO write
+        return HAL_OK;
+    case HISTORY_REG_CURSOR_LO:
+        history_cursor = ((uint32_t)history_cursor_hi << 16) | value;
+        History_Select();
+        return HAL_OK;
+    default:
+        return HAL_ERROR;
+    }
+}
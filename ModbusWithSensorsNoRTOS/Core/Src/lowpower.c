@@ -0,0 +1,79 @@
+/**
+ * @file    lowpower.c
+ * @brief   Sleep-on-idle for the main loop and sleep residency measurement
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * When the scheduler has nothing due, the core waits in Sleep mode (WFI)
+ * for the next interrupt instead of spinning. Every peripheral keeps its
+ * clock, so the UART DMA/idle-line reception, TIM3/TIM6 and the SysTick
+ * that releases the next task all wake the core within a few cycles, and
+ * Modbus replies (sent from the UART ISR) see no added latency. SysTick
+ * bounds each sleep to 1 ms.
+ *
+ * Stop mode is not used: it stops the PLL, the SysTick time base and the
+ * SYSCLK-clocked USART1, so a frame arriving at 9600 baud could lose its
+ * first byte and the scheduler would lose time.
+ */
+
+#include "lowpower.h"
+
+/* Private variables ---------------------------------------------------------*/
+static uint64_t lowpower_sleep_cycles; // Cycles spent in WFI since the last readout
+static uint32_t lowpower_window_start; // Tick of the last readout
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Start measuring sleep time (the cycle counter runs since Trace_Init())
+ * @param  None
+ * @retval None
+ */
+void LowPower_Init(void)
+{
+#ifdef DEBUG
+    // Keep the debug port alive while the core sleeps
+    HAL_DBGMCU_EnableDBGSleepMode();
+#endif
+
+    lowpower_sleep_cycles = 0;
+    lowpower_window_start = HAL_GetTick();
+}
+
+/**
+ * @brief  Sleep until the next interrupt (main loop, when nothing is due)
+ * @param  None
+ * @retval None
+ */
+void LowPower_Idle(void)
+{
+#if LOWPOWER_ENABLE
+    // With interrupts masked, a pending interrupt still ends WFI but its
+    // handler runs only after the sleep time has been accounted
+    __disable_irq();
+    uint32_t c0 = DWT->CYCCNT;
+    HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+    lowpower_sleep_cycles += DWT->CYCCNT - c0;
+    __enable_irq();
+#endif
+}
+
+/**
+ * @brief  Share of time spent asleep since the previous call
+ * @param  None
+ * @retval Sleep residency (% x 100, 0-10000)
+ */
+uint16_t LowPower_GetResidency(void)
+{
+    uint32_t now = HAL_GetTick();
+    uint64_t window_cycles = (uint64_t)(now - lowpower_window_start) * (SystemCoreClock / 1000);
+    uint64_t sleep_cycles = lowpower_sleep_cycles;
+
+    lowpower_sleep_cycles = 0;
+    lowpower_window_start = now;
+
+    if (window_cycles == 0)
+        return 0;
+    if (sleep_cycles >= window_cycles)
+        return 10000;
+    return (uint16_t)(sleep_cycles * 10000 / window_cycles);
+}
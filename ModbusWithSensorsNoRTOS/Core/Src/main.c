@@ -22,6 +22,13 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "sensors.h"
+#include "alarms.h"
+#include "history.h"
+#include "lowpower.h"
+#include "mq2_burst.h"
+#include "stats.h"
+#include "tasks.h"
+#include "trace.h"
 #include "modbus_init.h"
 #include "modbus_device.h"
 #include "uart_callbacks.h"
@@ -55,8 +62,7 @@ DMA_HandleTypeDef hdma_usart1_rx;
 DMA_HandleTypeDef hdma_usart1_tx;
 
 /* USER CODE BEGIN PV */
-volatile uint8_t timer_flag = 0;
-volatile uint32_t sensor_update_counter = 0;
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -70,7 +76,6 @@ static void MX_TIM3_Init(void);
 /* USER CODE BEGIN PFP */
 void ModbusRecovery_MarkActivity(void);
 void ModbusRecovery_MarkError(void);
-uint32_t mbus_tickcount(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -98,16 +103,6 @@ void ModbusRecovery_MarkError(void)
   // Could implement error recovery here
 }
 
-/**
- * @brief  Get system tick count for Modbus timing
- * @param  None
- * @retval Tick count in milliseconds
- */
-uint32_t mbus_tickcount(void)
-{
-  return HAL_GetTick();
-}
-
 /**
  * @brief  Timer 3 period elapsed callback (1 second timer)
  * @param  htim: Timer handle
@@ -117,13 +112,28 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
   if (htim == &htim3)
   {
-    // Set timer flag for main loop processing
-    timer_flag = 1;
-    sensor_update_counter++;
-
-    // Toggle LED to show system activity
+    // Heartbeat: toggle LED to show system activity
     HAL_GPIO_TogglePin(GPIOB, GPIO_PIN_3);
   }
+  else if (htim == &htim6)
+  {
+    // MQ2 burst capture sample clock
+    MQ2_Burst_TimerTick();
+  }
+}
+
+/**
+ * @brief  EXTI line detection callback
+ * @param  GPIO_Pin: Pin that triggered the interrupt
+ * @retval None
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  if (GPIO_Pin == SCD30_RDY_PIN)
+  {
+    // SCD30 signals a new measurement - read it from the main loop
+    SCD30_RdyCallback();
+  }
 }
 
 /* USER CODE END 0 */
@@ -146,6 +156,9 @@ int main(void)
 
   /* USER CODE BEGIN Init */
 
+  // Timestamps for the event trace, so peripheral bring-up is traced too
+  Trace_Init();
+
   /* USER CODE END Init */
 
   /* Configure the system clock */
@@ -164,20 +177,29 @@ int main(void)
   MX_TIM3_Init();
   /* USER CODE BEGIN 2 */
 
-  // Initialize sensors (MQ2 + SCD30)
+  // Sensor state only; the hardware is brought up from the main loop
   Sensors_Init();
 
-  // Initialize Modbus RTU slave
+  // Alarm rules start disabled until the master writes them
+  Alarms_Init();
+
+  // History ring and statistics windows start empty on every boot
+  History_Init();
+  Stats_Init();
+
+  // Initialize Modbus RTU slave before any sensor I/O, so the master gets
+  // answers right away and sees the sensors as "initialising" meanwhile
   Modbus_Init();
 
   // Initialize UART callbacks
   UART_Callbacks_Init();
 
-  // Start the 1-second timer for sensor updates
+  // Start the 1-second heartbeat LED timer
   HAL_TIM_Base_Start_IT(&htim3);
 
-  // Initial sensor update
-  Modbus_Device_UpdateSensors();
+  // Release the periodic tasks; sensor updates are skipped until bring-up is done
+  Tasks_Init();
+  LowPower_Init();
 
   /* USER CODE END 2 */
 
@@ -189,26 +211,27 @@ int main(void)
 
     /* USER CODE BEGIN 3 */
 
-    // Check if 1-second timer has elapsed
-    if (timer_flag)
+    // Sensor bring-up: ADC calibration, then the SCD30 once it has powered up
+    if (Sensors_InitStep())
     {
-      timer_flag = 0; // Clear flag
-
-      // Update all sensor readings and map to Modbus registers
-      Modbus_Device_UpdateSensors();
+      continue;
+    }
 
-      // Process any pending Modbus operations
-      Modbus_Process();
+    // Run the due task with the earliest deadline (sensors, mapping, trends)
+    if (Sched_RunNext())
+    {
+      continue;
+    }
 
-      // Optional: Debug output every 10 seconds
-      // if (sensor_update_counter % 10 == 0)
-      // {
-      //     Modbus_Device_DebugArray();
-      // }
+    // SCD30 RDY edge: fetch the new measurement right away instead of polling
+    if (SCD30_RdyPending())
+    {
+      SCD30_UpdateData();
+      continue;
     }
 
-    // Main loop can perform other tasks here
-    // Keep this loop fast to maintain Modbus responsiveness
+    // Nothing due: sleep until the next interrupt (Modbus is served from the UART ISR)
+    LowPower_Idle();
   }
   /* USER CODE END 3 */
 }
@@ -518,7 +541,17 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
   /* USER CODE BEGIN MX_GPIO_Init_2 */
-
+#if SCD30_USE_RDY_PIN
+  /*Configure GPIO pin : PB0 (SCD30 RDY, rising edge) */
+  GPIO_InitStruct.Pin = SCD30_RDY_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN; // Keeps the line low if RDY is not wired
+  HAL_GPIO_Init(SCD30_RDY_GPIO, &GPIO_InitStruct);
+
+  /* EXTI interrupt init - below UART so Modbus keeps priority */
+  HAL_NVIC_SetPriority(SCD30_RDY_EXTI_IRQn, 2, 0);
+  HAL_NVIC_EnableIRQ(SCD30_RDY_EXTI_IRQn);
+#endif
   /* USER CODE END MX_GPIO_Init_2 */
 }
 
@@ -5,15 +5,44 @@
  */
 
 #include "modbus_device.h"
+#include "alarms.h"
+#include "boot.h"
+#include "health.h"
+#include "history.h"
+#include "lowpower.h"
+#include "modbus.h"
+#include "modbus_prof.h"
+#include "mq2_burst.h"
+#include "mq2_gas.h"
+#include "sched.h"
 #include "sensors.h"
+#include "stats.h"
+#include "tasks.h"
+#include "trace.h"
 #include <math.h>
+#include <string.h>
 
 /* Private variables ---------------------------------------------------------*/
 // Device registers (Holding Registers - 4xxxx) - Mapped to sensor data
 uint16_t device_registers[20] = {0};
 
+// Diagnostic registers (Input Registers - 3xxxx) - Read-only
+uint16_t input_registers[MODBUS_INPUT_REG_COUNT] = {0};
+
+// Changed-register bitmaps for 40001-40020, one per master slot (read-and-clear)
+static volatile uint32_t dirty_bitmap[MODBUS_DIRTY_SLOTS] = {0};
+
 /* Private function prototypes -----------------------------------------------*/
 static uint16_t Float_To_ModbusRegister(float value, float scale);
+static uint16_t SCD30_Config_Read(uint16_t offset);
+static void SCD30_Config_Write(uint16_t offset, uint16_t value);
+static uint16_t MQ2_Gas_Read(uint16_t offset);
+static void MQ2_Gas_Write(uint16_t offset, uint16_t value);
+static uint16_t MQ2_Comp_Read(uint16_t offset);
+static void Modbus_Device_MarkDirty(uint32_t mask);
+static uint16_t Dirty_ReadAndClear(uint16_t offset);
+static uint16_t Coil_Read(uint32_t coil);
+static void Coil_Write(uint32_t coil, uint16_t value);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -39,6 +68,229 @@ static uint16_t Float_To_ModbusRegister(float value, float scale)
     return (uint16_t)scaled;
 }
 
+/**
+ * @brief  Read SCD30 configuration register
+ * @param  offset: Offset from MODBUS_SCD30_CFG_BASE
+ * @retval Register value
+ */
+static uint16_t SCD30_Config_Read(uint16_t offset)
+{
+    if (offset < SCD30_CFG_COUNT)
+        return scd30_config.value[offset]; // 40101-40106: settings
+    if (offset == SCD30_CFG_COUNT)
+        return scd30_config.pending; // 40107: items waiting to be sent
+    return scd30_config.errors;      // 40108: items whose last send failed
+}
+
+/**
+ * @brief  Write SCD30 configuration register (queued, sent by main loop)
+ * @param  offset: Offset from MODBUS_SCD30_CFG_BASE
+ * @param  value: Value to write
+ * @retval None
+ */
+static void SCD30_Config_Write(uint16_t offset, uint16_t value)
+{
+    if (offset >= SCD30_CFG_COUNT)
+    {
+        // Status registers are read-only
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+        return;
+    }
+
+    if (SCD30_RequestConfig((SCD30_ConfigItem_t)offset, value) != HAL_OK)
+    {
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+    }
+}
+
+/**
+ * @brief  Flag registers 40001-40020 as changed for every master slot
+ * @param  mask: Bit n = register 40001+n changed
+ * @retval None
+ */
+static void Modbus_Device_MarkDirty(uint32_t mask)
+{
+    if (mask == 0)
+        return;
+
+    // The Modbus ISR clears bits concurrently; keep the read-modify-write atomic
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    for (uint8_t i = 0; i < MODBUS_DIRTY_SLOTS; i++)
+    {
+        dirty_bitmap[i] |= mask;
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Read one half of a slot's change bitmap and clear it (Modbus ISR)
+ * @param  offset: Offset from MODBUS_DIRTY_BASE
+ * @retval Bits 0-15 (even offset) or 16-19 (odd offset) of the slot's bitmap
+ * @note   Only the returned half is cleared, so reading both registers in one
+ *         FC03 request hands over every change exactly once.
+ */
+static uint16_t Dirty_ReadAndClear(uint16_t offset)
+{
+    uint8_t slot = offset / 2;
+    uint8_t shift = (offset & 1) ? 16 : 0;
+
+    uint16_t bits = (uint16_t)(dirty_bitmap[slot] >> shift);
+    dirty_bitmap[slot] &= ~((uint32_t)bits << shift);
+    return bits;
+}
+
+/**
+ * @brief  Read MQ2 gas estimation register
+ * @param  offset: Offset from MODBUS_MQ2_GAS_BASE
+ * @retval Register value
+ */
+static uint16_t MQ2_Gas_Read(uint16_t offset)
+{
+    uint8_t ch = offset % MQ2_NUM_CHANNELS;
+
+    switch (offset / MQ2_NUM_CHANNELS)
+    {
+    case 0:
+        return mq2_gas.ratio_x100[ch]; // 40201-40204: Rs/R0 x 100
+    case 1:
+        return mq2_gas.ppm[MQ2_GAS_LPG][ch]; // 40205-40208: LPG ppm
+    case 2:
+        return mq2_gas.ppm[MQ2_GAS_CH4][ch]; // 40209-40212: CH4 ppm
+    case 3:
+        return mq2_gas.ppm[MQ2_GAS_SMOKE][ch]; // 40213-40216: Smoke ppm
+    case 4:
+        // 40217-40220: R0 ohms
+        return (mq2_gas.r0_ohms[ch] > 0xFFFF) ? 0xFFFF : (uint16_t)mq2_gas.r0_ohms[ch];
+    case 5:
+        return mq2_gas.state[ch]; // 40221-40224: 0=cold, 1=warming, 2=stable, 3=drifted
+    case 6:
+        return (uint16_t)mq2_gas.delta_mv[ch]; // 40225-40228: AOUT - baseline (mV, signed)
+    case 7:
+        return mq2_gas.baseline_mv[ch]; // 40229-40232: baseline (mV)
+    default:
+        // 40233: bits 0-3 ready, bits 4-7 drifted
+        return (uint16_t)(mq2_gas.ready_mask | (mq2_gas.drift_mask << 4));
+    }
+}
+
+/**
+ * @brief  Write MQ2 gas estimation register (only R0 is writable)
+ * @param  offset: Offset from MODBUS_MQ2_GAS_BASE
+ * @param  value: Value to write
+ * @retval None
+ */
+static void MQ2_Gas_Write(uint16_t offset, uint16_t value)
+{
+    if (offset < 4 * MQ2_NUM_CHANNELS || offset >= 5 * MQ2_NUM_CHANNELS)
+    {
+        // Measurements are read-only
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+        return;
+    }
+
+    // Restore a previously stored R0 (not persisted across resets)
+    if (MQ2_Gas_SetR0(offset % MQ2_NUM_CHANNELS, value) != HAL_OK)
+    {
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+    }
+}
+
+/**
+ * @brief  Read MQ2 temperature/humidity compensated register
+ * @param  offset: Offset from MODBUS_MQ2_COMP_BASE
+ * @retval Register value
+ */
+static uint16_t MQ2_Comp_Read(uint16_t offset)
+{
+    uint8_t ch = offset % MQ2_NUM_CHANNELS;
+
+    switch (offset / MQ2_NUM_CHANNELS)
+    {
+    case 0:
+        return mq2_gas.ratio_comp_x100[ch]; // 40301-40304: corrected Rs/R0 x 100
+    case 1:
+        return mq2_gas.ppm_comp[MQ2_GAS_LPG][ch]; // 40305-40308: corrected LPG ppm
+    case 2:
+        return mq2_gas.ppm_comp[MQ2_GAS_CH4][ch]; // 40309-40312: corrected CH4 ppm
+    case 3:
+        return mq2_gas.ppm_comp[MQ2_GAS_SMOKE][ch]; // 40313-40316: corrected smoke ppm
+    default:
+        if (offset == 4 * MQ2_NUM_CHANNELS)
+            return mq2_gas.comp_factor_x1000; // 40317: correction factor x 1000
+        return mq2_gas.comp_active;           // 40318: 1 = SCD30 data applied
+    }
+}
+
+/**
+ * @brief  Read coil state
+ * @param  coil: Coil address (00001-00009)
+ * @retval 1 while the commanded action is still running, else 0
+ */
+static uint16_t Coil_Read(uint32_t coil)
+{
+    if (coil == MODBUS_COIL_PROF_RESET)
+        return 0;
+    if (coil == MODBUS_COIL_TRACE_FREEZE)
+        return Trace_IsFrozen();
+    if (coil == MODBUS_COIL_BURST_ARM)
+        return MQ2_Burst_IsSampling();
+    if (coil == MODBUS_COIL_BURST_TRIG)
+        return MQ2_Burst_ReadRegister(MQ2_BURST_REG_STATE) == MQ2_BURST_TRIGGERED;
+    if (coil == MODBUS_COIL_MQ2_CAL_ALL)
+        return mq2_gas.cal_pending ? 1 : 0;
+    return (mq2_gas.cal_pending & (1U << (coil - MODBUS_COIL_BASE))) ? 1 : 0;
+}
+
+/**
+ * @brief  Write coil (FC05): R0 calibration, burst capture, trace and profiling commands
+ * @param  coil: Coil address (00001-00009)
+ * @param  value: 0xFF00 = ON, 0x0000 = OFF
+ * @retval None
+ */
+static void Coil_Write(uint32_t coil, uint16_t value)
+{
+    if (value != 0xFF00 && value != 0x0000)
+    {
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+        return;
+    }
+
+    if (coil == MODBUS_COIL_TRACE_FREEZE)
+    {
+        Trace_Freeze(value == 0xFF00);
+        return;
+    }
+
+    if (coil == MODBUS_COIL_PROF_RESET)
+    {
+#if MODBUS_PROF_ENABLE
+        if (value == 0xFF00)
+            ModbusProf_Reset();
+#endif
+        return;
+    }
+
+    if (coil == MODBUS_COIL_BURST_ARM)
+    {
+        if (value == 0x0000)
+            MQ2_Burst_Disarm();
+        else if (MQ2_Burst_Arm() != HAL_OK)
+            mbus_error(MBUS_RESPONSE_SERVICE_DEVICE_FAILURE);
+        return;
+    }
+
+    if (value == 0x0000)
+        return; // OFF has no effect; the action clears the coil when done
+
+    if (coil == MODBUS_COIL_BURST_TRIG)
+        MQ2_Burst_Trigger();
+    else if (coil == MODBUS_COIL_MQ2_CAL_ALL)
+        MQ2_Gas_RequestCalibration((1U << MQ2_NUM_CHANNELS) - 1);
+    else
+        MQ2_Gas_RequestCalibration(1U << (coil - MODBUS_COIL_BASE));
+}
+
 /* Future use - convert Modbus register back to float (currently unused)
 static float ModbusRegister_To_Float(uint16_t value, float scale)
 {
@@ -81,9 +333,173 @@ uint16_t Modbus_Device_Read(uint32_t logical_address)
         return value;
     }
 
+    // SCD30 configuration 40101-40108
+    if (logical_address >= MODBUS_SCD30_CFG_BASE &&
+        logical_address < MODBUS_SCD30_CFG_BASE + MODBUS_SCD30_CFG_COUNT)
+    {
+        return SCD30_Config_Read(logical_address - MODBUS_SCD30_CFG_BASE);
+    }
+
+    // MQ2 gas estimation and warm-up status 40201-40233
+    if (logical_address >= MODBUS_MQ2_GAS_BASE &&
+        logical_address < MODBUS_MQ2_GAS_BASE + MODBUS_MQ2_GAS_COUNT)
+    {
+        return MQ2_Gas_Read(logical_address - MODBUS_MQ2_GAS_BASE);
+    }
+
+    // MQ2 compensated values 40301-40318
+    if (logical_address >= MODBUS_MQ2_COMP_BASE &&
+        logical_address < MODBUS_MQ2_COMP_BASE + MODBUS_MQ2_COMP_COUNT)
+    {
+        return MQ2_Comp_Read(logical_address - MODBUS_MQ2_COMP_BASE);
+    }
+
+    // Change bitmaps 40501-40508 (read-and-clear per master slot)
+    if (logical_address >= MODBUS_DIRTY_BASE &&
+        logical_address < MODBUS_DIRTY_BASE + MODBUS_DIRTY_COUNT)
+    {
+        return Dirty_ReadAndClear(logical_address - MODBUS_DIRTY_BASE);
+    }
+
+    // Alarm summary 40401 and rules 40402-40449
+    if (logical_address == MODBUS_ALARM_SUMMARY)
+    {
+        return Alarms_GetSummary();
+    }
+
+    if (logical_address >= MODBUS_ALARM_RULE_BASE &&
+        logical_address < MODBUS_ALARM_RULE_BASE + MODBUS_ALARM_RULE_COUNT)
+    {
+        uint16_t offset = logical_address - MODBUS_ALARM_RULE_BASE;
+        return Alarms_ReadRule(offset / ALARM_FIELD_COUNT, (Alarm_Field_t)(offset % ALARM_FIELD_COUNT));
+    }
+
+    // MQ2 burst capture 40601-40610
+    if (logical_address >= MODBUS_BURST_BASE &&
+        logical_address < MODBUS_BURST_BASE + MODBUS_BURST_COUNT)
+    {
+        return MQ2_Burst_ReadRegister((MQ2_BurstReg_t)(logical_address - MODBUS_BURST_BASE));
+    }
+
+    // History ring 40701-40776
+    if (logical_address >= MODBUS_HISTORY_BASE &&
+        logical_address < MODBUS_HISTORY_BASE + MODBUS_HISTORY_COUNT)
+    {
+        return History_ReadRegister(logical_address - MODBUS_HISTORY_BASE);
+    }
+
+    // Statistics window lengths 40801-40803
+    if (logical_address >= MODBUS_STATS_CFG_BASE &&
+        logical_address < MODBUS_STATS_CFG_BASE + MODBUS_STATS_CFG_COUNT)
+    {
+        return Stats_GetWindow(logical_address - MODBUS_STATS_CFG_BASE);
+    }
+
+    // Discrete inputs 10001-10008 (alarm states)
+    if (logical_address >= MODBUS_DISCRETE_BASE &&
+        logical_address < MODBUS_DISCRETE_BASE + MODBUS_DISCRETE_COUNT)
+    {
+        return Alarms_GetState(logical_address - MODBUS_DISCRETE_BASE);
+    }
+
+    // Coils 00001-00009
+    if (logical_address >= MODBUS_COIL_BASE &&
+        logical_address < MODBUS_COIL_BASE + MODBUS_COIL_COUNT)
+    {
+        return Coil_Read(logical_address);
+    }
+
+    // Input registers 30001+ (diagnostics)
+    if (logical_address >= MODBUS_INPUT_REG_BASE &&
+        logical_address < MODBUS_INPUT_REG_BASE + MODBUS_INPUT_REG_COUNT)
+    {
+        return input_registers[logical_address - MODBUS_INPUT_REG_BASE];
+    }
+
+    // Boot milestones 30008-30015
+    if (logical_address >= MODBUS_BOOT_BASE &&
+        logical_address < MODBUS_BOOT_BASE + MODBUS_BOOT_COUNT)
+    {
+        uint16_t offset = logical_address - MODBUS_BOOT_BASE;
+        return Boot_ReadRegister((Boot_Milestone_t)(offset / BOOT_REG_COUNT), (Boot_Reg_t)(offset % BOOT_REG_COUNT));
+    }
+
+    // Statistics snapshots 30101+, one block per window
+    if (logical_address >= MODBUS_STATS_BASE &&
+        logical_address < MODBUS_STATS_BASE + MODBUS_STATS_WINDOWS * MODBUS_STATS_STRIDE)
+    {
+        uint16_t offset = logical_address - MODBUS_STATS_BASE;
+        return Stats_ReadSnapshot(offset / MODBUS_STATS_STRIDE, offset % MODBUS_STATS_STRIDE);
+    }
+
+    // Sensor health records 30401-30445
+    if (logical_address >= MODBUS_HEALTH_BASE &&
+        logical_address < MODBUS_HEALTH_BASE + MODBUS_HEALTH_COUNT)
+    {
+        uint16_t offset = logical_address - MODBUS_HEALTH_BASE;
+        return Health_ReadRegister((Health_Sensor_t)(offset / HEALTH_REG_COUNT), (Health_Reg_t)(offset % HEALTH_REG_COUNT));
+    }
+
+    // Value quality codes 30501-30515 (same order as 40001-40015)
+    if (logical_address >= MODBUS_QUALITY_BASE &&
+        logical_address < MODBUS_QUALITY_BASE + MODBUS_QUALITY_COUNT)
+    {
+        return Health_ReadValueQuality(logical_address - MODBUS_QUALITY_BASE);
+    }
+
+    // Scheduler task records 30601-30635
+    if (logical_address >= MODBUS_SCHED_BASE &&
+        logical_address < MODBUS_SCHED_BASE + MODBUS_SCHED_COUNT)
+    {
+        uint16_t offset = logical_address - MODBUS_SCHED_BASE;
+        return Sched_ReadRegister(offset / SCHED_REG_COUNT, (Sched_Reg_t)(offset % SCHED_REG_COUNT));
+    }
+
+#if MODBUS_PROF_ENABLE
+    // Request path cycle histograms 30701-30980
+    if (logical_address >= MODBUS_PROF_BASE &&
+        logical_address < MODBUS_PROF_BASE + MODBUS_PROF_COUNT)
+    {
+        uint16_t offset = logical_address - MODBUS_PROF_BASE;
+        return ModbusProf_ReadRegister((ModbusProf_Hist_t)(offset / MODBUS_PROF_REG_COUNT),
+                                       (ModbusProf_Reg_t)(offset % MODBUS_PROF_REG_COUNT));
+    }
+#endif
+
     return 0; // Invalid address
 }
 
+/**
+ * @brief  Modbus read file record callback (FC20)
+ * @param  file: File number (0 = burst header, 1-4 = MQ2 CH0-CH3 waveform,
+ *               16 = trace header, 17 = trace records)
+ * @param  record: Record (register) number within the file
+ * @retval Register value
+ */
+uint16_t Modbus_Device_ReadFile(uint16_t file, uint16_t record)
+{
+    uint16_t value = 0;
+    HAL_StatusTypeDef res;
+
+    if (file == TRACE_FILE_HEADER || file == TRACE_FILE_RECORDS)
+        res = Trace_ReadRecord(file, record, &value);
+    else
+        res = MQ2_Burst_ReadRecord(file, record, &value);
+
+    switch (res)
+    {
+    case HAL_OK:
+        break;
+    case HAL_BUSY:
+        mbus_error(MBUS_RESPONSE_SLAVE_DEVICE_BUSY); // No frozen capture / trace yet
+        break;
+    default:
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+        break;
+    }
+    return value;
+}
+
 /**
  * @brief  Modbus device write callback
  * @param  logical_address: Modbus logical address (40001, 40002, etc.)
@@ -111,8 +527,10 @@ uint16_t Modbus_Device_Write(uint32_t logical_address, uint16_t value)
         case 40020: // Sensor force update command
             if (value == 0x5678)
             {
-                // Force immediate sensor update
-                Sensors_UpdateAll();
+                // Sample both sensors from the main loop as soon as possible;
+                // ADC and I2C work never runs in this interrupt
+                Sched_Request(TASK_MQ2);
+                Sched_Request(TASK_SCD30);
             }
             break;
         default:
@@ -121,7 +539,94 @@ uint16_t Modbus_Device_Write(uint32_t logical_address, uint16_t value)
         }
 
         // Store the value
-        device_registers[index] = value;
+        if (device_registers[index] != value)
+        {
+            device_registers[index] = value;
+            Modbus_Device_MarkDirty(1UL << index);
+        }
+        return value;
+    }
+
+    // SCD30 configuration - applied asynchronously, never from this ISR
+    if (logical_address >= MODBUS_SCD30_CFG_BASE &&
+        logical_address < MODBUS_SCD30_CFG_BASE + MODBUS_SCD30_CFG_COUNT)
+    {
+        SCD30_Config_Write(logical_address - MODBUS_SCD30_CFG_BASE, value);
+        return value;
+    }
+
+    // MQ2 R0 40217-40220 (others in the block are read-only)
+    if (logical_address >= MODBUS_MQ2_GAS_BASE &&
+        logical_address < MODBUS_MQ2_GAS_BASE + MODBUS_MQ2_GAS_COUNT)
+    {
+        MQ2_Gas_Write(logical_address - MODBUS_MQ2_GAS_BASE, value);
+        return value;
+    }
+
+    // Alarm rules 40402-40449 (summary 40401 is read-only)
+    if (logical_address >= MODBUS_ALARM_RULE_BASE &&
+        logical_address < MODBUS_ALARM_RULE_BASE + MODBUS_ALARM_RULE_COUNT)
+    {
+        uint16_t offset = logical_address - MODBUS_ALARM_RULE_BASE;
+        if (Alarms_WriteRule(offset / ALARM_FIELD_COUNT, (Alarm_Field_t)(offset % ALARM_FIELD_COUNT), value) != HAL_OK)
+        {
+            mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+        }
+        return value;
+    }
+    if (logical_address == MODBUS_ALARM_SUMMARY)
+    {
+        mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+        return 0;
+    }
+
+    // MQ2 burst configuration 40601-40604 (status 40605-40610 is read-only)
+    if (logical_address >= MODBUS_BURST_BASE &&
+        logical_address < MODBUS_BURST_BASE + MODBUS_BURST_COUNT)
+    {
+        switch (MQ2_Burst_WriteRegister((MQ2_BurstReg_t)(logical_address - MODBUS_BURST_BASE), value))
+        {
+        case HAL_OK:
+            break;
+        case HAL_BUSY:
+            mbus_error(MBUS_RESPONSE_SLAVE_DEVICE_BUSY); // Disarm first
+            break;
+        default:
+            mbus_error(logical_address - MODBUS_BURST_BASE > MQ2_BURST_REG_ALARM_MASK
+                           ? MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS
+                           : MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+            break;
+        }
+        return value;
+    }
+
+    // Statistics window lengths 40801-40803 (the window restarts empty)
+    if (logical_address >= MODBUS_STATS_CFG_BASE &&
+        logical_address < MODBUS_STATS_CFG_BASE + MODBUS_STATS_CFG_COUNT)
+    {
+        if (Stats_SetWindow(logical_address - MODBUS_STATS_CFG_BASE, value) != HAL_OK)
+        {
+            mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+        }
+        return value;
+    }
+
+    // History cursor 40705-40706 (everything else in 40701-40776 is read-only)
+    if (logical_address >= MODBUS_HISTORY_BASE &&
+        logical_address < MODBUS_HISTORY_BASE + MODBUS_HISTORY_COUNT)
+    {
+        if (History_WriteRegister(logical_address - MODBUS_HISTORY_BASE, value) != HAL_OK)
+        {
+            mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+        }
+        return value;
+    }
+
+    // Coils 00001-00009 (command triggers)
+    if (logical_address >= MODBUS_COIL_BASE &&
+        logical_address < MODBUS_COIL_BASE + MODBUS_COIL_COUNT)
+    {
+        Coil_Write(logical_address, value);
         return value;
     }
 
@@ -129,14 +634,15 @@ uint16_t Modbus_Device_Write(uint32_t logical_address, uint16_t value)
 }
 
 /**
- * @brief  Update sensor values and map to Modbus registers
+ * @brief  Map the latest sensor values to Modbus registers
  * @param  None
  * @retval None
  */
 void Modbus_Device_UpdateSensors(void)
 {
-    // Update all sensor readings
-    Sensors_UpdateAll();
+    // Snapshot to find which registers this update changes
+    uint16_t previous[20];
+    memcpy(previous, device_registers, sizeof(previous));
 
     // Map MQ2 sensor values to registers 40001-40004 (raw ADC values)
     device_registers[0] = Sensors_GetMQ2Value(0); // 40001: MQ2 CH0 ADC
@@ -183,6 +689,38 @@ void Modbus_Device_UpdateSensors(void)
     device_registers[17] = (uint16_t)(sensor_data.last_update / 1000); // 40018: Last sensor update (seconds)
 
     // Configuration/diagnostic registers (40015-40020) are handled by write function
+
+    // Publish changes of 40001-40020 to the per-master bitmaps
+    uint32_t changed = 0;
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        if (device_registers[i] != previous[i])
+            changed |= 1UL << i;
+    }
+    Modbus_Device_MarkDirty(changed);
+
+    // Evaluate alarm rules against the freshly mapped registers
+    Alarms_Evaluate();
+
+    // Rising alarms can trigger an armed MQ2 burst capture
+    MQ2_Burst_CheckAlarms((uint8_t)Alarms_GetSummary());
+}
+
+/**
+ * @brief  Refresh the diagnostic input registers 30001-30007
+ * @param  None
+ * @retval None
+ */
+void Modbus_Device_UpdateDiagnostics(void)
+{
+    // SCD30 bus efficiency diagnostics (input registers 30001-30004)
+    input_registers[0] = SCD30_GetTransactionsPerSample();             // 30001: I2C transactions per sample (x100)
+    input_registers[1] = sensor_data.scd30_rdy_mode;                   // 30002: 1=RDY pin, 0=polling fallback
+    input_registers[2] = (uint16_t)sensor_data.scd30_samples;          // 30003: Samples read (low 16 bits)
+    input_registers[3] = (uint16_t)sensor_data.scd30_i2c_transactions; // 30004: I2C transactions (low 16 bits)
+    input_registers[4] = sensor_data.vdda_mv;                          // 30005: Measured Vdda (mV)
+    input_registers[5] = (uint16_t)sensor_data.mcu_temp_c100;          // 30006: MCU temperature (°C x 100, signed)
+    input_registers[6] = LowPower_GetResidency();                      // 30007: Sleep residency since last refresh (% x 100)
 }
 
 /**
@@ -193,9 +731,10 @@ void Modbus_Device_UpdateSensors(void)
  */
 void Modbus_Device_SetRegister(uint8_t index, uint16_t value)
 {
-    if (index < 20)
+    if (index < 20 && device_registers[index] != value)
     {
         device_registers[index] = value;
+        Modbus_Device_MarkDirty(1UL << index);
     }
 }
 
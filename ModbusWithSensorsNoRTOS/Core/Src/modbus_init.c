@@ -5,9 +5,12 @@
  */
 
 #include "modbus_init.h"
+#include "boot.h"
 #include "main.h"
 #include "modbus_device.h"
 #include "mbutils.h"
+#include "modbus_prof.h"
+#include "trace.h"
 
 /* Private variables ---------------------------------------------------------*/
 extern UART_HandleTypeDef huart1;
@@ -32,12 +35,13 @@ void Modbus_Init(void)
 
     // Configure Modbus
     modbus_config.devaddr = 0x01; // Slave address
-    modbus_config.coils = 0;      // No internal coil handling
-    modbus_config.discrete = 0;   // No internal discrete handling
+    modbus_config.coils = MODBUS_COIL_COUNT; // Coils 00001-00009 (commands)
+    modbus_config.discrete = MODBUS_DISCRETE_COUNT; // Discrete inputs 10001-10008 (alarms)
     modbus_config.device = NULL;  // No device pointer needed
     modbus_config.send = Modbus_SendData;
     modbus_config.read = Modbus_Device_Read;
     modbus_config.write = Modbus_Device_Write;
+    modbus_config.read_file = Modbus_Device_ReadFile; // FC20: MQ2 burst capture
     modbus_config.sendbuf = modbus_tx_buffer;
     modbus_config.sendbuf_sz = sizeof(modbus_tx_buffer);
     modbus_config.recvbuf = modbus_rx_buffer;
@@ -87,6 +91,8 @@ void Modbus_Init(void)
     // Enable UART idle line interrupt for Modbus frame detection
     __HAL_UART_ENABLE_IT(&huart1, UART_IT_IDLE);
     // printf("UART idle interrupt enabled\n"); // Removed
+
+    Boot_Mark(BOOT_MODBUS_ONLINE);
 }
 
 /**
@@ -121,11 +127,15 @@ static int Modbus_SendData(const mbus_t context, const uint8_t *data, const uint
     // }
     // printf("\n");
 
+    MODBUS_PROF_MARK(MODBUS_PROF_TX_START, 0);
     HAL_StatusTypeDef status = HAL_UART_Transmit(&huart1, (uint8_t *)data, size, 1000);
+    MODBUS_PROF_MARK(MODBUS_PROF_TX_DONE, 0);
 
     if (status == HAL_OK)
     {
         // printf("TX Success\n"); // Removed to prevent timing delays
+        TRACE(TRACE_EV_RESPONSE, (uint16_t)((data[1] << 8) | (size & 0xFF)));
+        Boot_Mark(BOOT_FIRST_REPLY);
         return size;
     }
     else
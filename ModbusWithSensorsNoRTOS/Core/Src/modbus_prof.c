@@ -0,0 +1,174 @@
+/**
+ * @file    modbus_prof.c
+ * @brief   DWT cycle-count histograms of the Modbus request path
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * A request is handled from start to finish in the USART1 interrupt: idle
+ * line, mbus_poll() over the frame, mbus_poll_response(), the reply CRC and
+ * the blocking Modbus_SendData(). Each step stores DWT->CYCCNT at a stamp
+ * point; nothing else happens on the measured path. Once the reply is out,
+ * the stage times are binned into log2 histograms, so the binning never
+ * shows up in the figures it produces.
+ *
+ * Stamps are only taken in the USART1 interrupt and the registers are read
+ * from it as well, so no locking is needed. The DWT counter is the one
+ * Trace_Init() starts.
+ */
+
+#include "modbus_prof.h"
+#include "modbus.h"
+#include <string.h>
+
+#if MODBUS_PROF_ENABLE
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t count;
+    uint32_t max;
+    uint16_t bucket[MODBUS_PROF_BUCKETS];
+} ModbusProf_Histogram_t;
+
+/* Private variables ---------------------------------------------------------*/
+static ModbusProf_Histogram_t prof_hist[MODBUS_PROF_HIST_COUNT];
+static uint32_t prof_stamp[MODBUS_PROF_POINT_COUNT];
+static uint32_t prof_marked; // Bit n = prof_stamp[n] belongs to the current request
+static uint8_t prof_func;    // Function code of the current request
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Histogram of mbus_poll_response() for a function code
+ * @param  func: Function code
+ * @retval MODBUS_PROF_FC*
+ */
+static ModbusProf_Hist_t ModbusProf_FuncHist(uint8_t func)
+{
+    switch (func)
+    {
+    case MBUS_FUNC_READ_COILS:
+        return MODBUS_PROF_FC01;
+    case MBUS_FUNC_READ_DISCRETE:
+        return MODBUS_PROF_FC02;
+    case MBUS_FUNC_READ_REGS:
+        return MODBUS_PROF_FC03;
+    case MBUS_FUNC_READ_INPUT_REGS:
+        return MODBUS_PROF_FC04;
+    case MBUS_FUNC_WRITE_COIL:
+        return MODBUS_PROF_FC05;
+    case MBUS_FUNC_WRITE_REG:
+        return MODBUS_PROF_FC06;
+    case MBUS_FUNC_WRITE_COILS:
+        return MODBUS_PROF_FC15;
+    case MBUS_FUNC_WRITE_REGS:
+        return MODBUS_PROF_FC16;
+    case MBUS_FUNC_READ_FILE_RECORD:
+        return MODBUS_PROF_FC20;
+    default:
+        return MODBUS_PROF_FC_OTHER;
+    }
+}
+
+/**
+ * @brief  Add the time between two stamps to a histogram
+ * @param  hist: Histogram
+ * @param  from: Stamp point where the stage starts
+ * @param  to: Stamp point where it ends
+ * @retval None
+ * @note   Skipped unless both stamps were taken for the current request.
+ */
+static void ModbusProf_Add(ModbusProf_Hist_t hist, uint8_t from, uint8_t to)
+{
+    uint32_t need = (1U << from) | (1U << to);
+    if ((prof_marked & need) != need)
+        return;
+
+    ModbusProf_Histogram_t *h = &prof_hist[hist];
+    uint32_t cycles = prof_stamp[to] - prof_stamp[from];
+
+    // Bucket n holds 2^(n+6) to 2^(n+7) - 1 cycles: one CLZ instruction
+    uint32_t b = (cycles < 128) ? 0 : (31 - __CLZ(cycles)) - 6;
+    if (b >= MODBUS_PROF_BUCKETS)
+        b = MODBUS_PROF_BUCKETS - 1;
+
+    h->count++;
+    if (cycles > h->max)
+        h->max = cycles;
+    if (h->bucket[b] != 0xFFFF)
+        h->bucket[b]++;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Stamp a point of the request path (USART1 interrupt)
+ * @param  point: MBUS_PROF_* or MODBUS_PROF_*
+ * @param  func: Function code of the request (engine points), else 0
+ * @retval None
+ */
+void ModbusProf_Mark(uint8_t point, uint8_t func)
+{
+    uint32_t now = DWT->CYCCNT;
+
+    if (point >= MODBUS_PROF_POINT_COUNT)
+        return;
+
+    // A new frame drops whatever is left of a request that got no reply
+    if (point == MODBUS_PROF_RX)
+        prof_marked = 0;
+    if (point == MBUS_PROF_PARSED)
+        prof_func = func;
+
+    prof_stamp[point] = now;
+    prof_marked |= 1U << point;
+
+    if (point != MODBUS_PROF_TX_DONE)
+        return;
+
+    ModbusProf_Add(MODBUS_PROF_TURNAROUND, MODBUS_PROF_RX, MODBUS_PROF_TX_START);
+    ModbusProf_Add(MODBUS_PROF_PARSE, MBUS_PROF_FRAME, MBUS_PROF_PARSED);
+    ModbusProf_Add(MODBUS_PROF_CRC, MBUS_PROF_BUILT, MBUS_PROF_CRC);
+    ModbusProf_Add(MODBUS_PROF_SEND, MODBUS_PROF_TX_START, MODBUS_PROF_TX_DONE);
+    ModbusProf_Add(ModbusProf_FuncHist(prof_func), MBUS_PROF_PARSED, MBUS_PROF_BUILT);
+    prof_marked = 0;
+}
+
+/**
+ * @brief  Clear every histogram (coil 00009)
+ * @param  None
+ * @retval None
+ */
+void ModbusProf_Reset(void)
+{
+    memset(prof_hist, 0, sizeof(prof_hist));
+    prof_marked = 0;
+}
+
+/**
+ * @brief  Read one histogram register
+ * @param  hist: Histogram
+ * @param  reg: Register within the histogram
+ * @retval Register value
+ */
+uint16_t ModbusProf_ReadRegister(ModbusProf_Hist_t hist, ModbusProf_Reg_t reg)
+{
+    if (hist >= MODBUS_PROF_HIST_COUNT || reg >= MODBUS_PROF_REG_COUNT)
+        return 0;
+
+    const ModbusProf_Histogram_t *h = &prof_hist[hist];
+    switch (reg)
+    {
+    case MODBUS_PROF_REG_COUNT_HI:
+        return (uint16_t)(h->count >> 16);
+    case MODBUS_PROF_REG_COUNT_LO:
+        return (uint16_t)h->count;
+    case MODBUS_PROF_REG_MAX_HI:
+        return (uint16_t)(h->max >> 16);
+    case MODBUS_PROF_REG_MAX_LO:
+        return (uint16_t)h->max;
+    default:
+        return h->bucket[reg - MODBUS_PROF_REG_BUCKETS];
+    }
+}
+
+#endif /* MODBUS_PROF_ENABLE */
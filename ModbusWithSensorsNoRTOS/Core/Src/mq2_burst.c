@@ -0,0 +1,321 @@
+/**
+ * @file    mq2_burst.c
+ * @brief   High-rate MQ2 waveform capture with pre/post-trigger windows
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * TIM6 paces ADC scans at the configured rate. Once armed, every scan's four
+ * MQ2 counts are pushed into a ring in CCM RAM, so the ring always holds the
+ * most recent pre-trigger window. A trigger (coil, alarm rule) records the
+ * post-trigger window and then freezes the ring until the master re-arms.
+ * While a burst is sampling the 1 Hz sensor update reuses the latest scan
+ * instead of starting its own.
+ */
+
+#include "mq2_burst.h"
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+TIM_HandleTypeDef htim6;
+
+// Only the CPU touches the ring (copied in the DMA callback), so CCM RAM is fine
+static uint16_t burst_ring[MQ2_BURST_DEPTH][MQ2_NUM_CHANNELS] __attribute__((section(".ccmram")));
+
+static uint16_t burst_rate_hz = 1000;
+static uint16_t burst_pre_ms = 100;
+static uint16_t burst_post_ms = 300;
+static uint8_t burst_alarm_mask = 0;
+static uint8_t burst_prev_alarms = 0;
+
+static volatile uint8_t burst_state = MQ2_BURST_IDLE;
+static uint16_t burst_pre;         // Pre-trigger samples requested
+static uint16_t burst_post;        // Post-trigger samples requested
+static uint16_t burst_remaining;   // Post-trigger samples still to record
+static uint16_t burst_wr;          // Next ring slot to write
+static uint16_t burst_filled;      // Valid samples in the ring
+static uint16_t burst_start;       // Ring slot of record 0 once frozen
+static uint16_t burst_count;       // Samples per channel once frozen
+static uint16_t burst_trigger_idx; // Record of the first post-trigger sample
+static uint16_t burst_actual_hz;
+static uint16_t burst_captures;
+static uint16_t burst_overruns;
+
+/* Private function prototypes -----------------------------------------------*/
+static void MQ2_Burst_Freeze(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Stop sampling and publish the capture window
+ * @param  None
+ * @retval None
+ * @note   Runs in the ADC DMA interrupt.
+ */
+static void MQ2_Burst_Freeze(void)
+{
+    HAL_TIM_Base_Stop_IT(&htim6);
+
+    burst_count = (burst_filled < burst_pre + burst_post) ? burst_filled : (burst_pre + burst_post);
+    burst_start = (burst_wr + MQ2_BURST_DEPTH - burst_count) % MQ2_BURST_DEPTH;
+    burst_trigger_idx = burst_count - burst_post;
+    burst_captures++;
+    burst_state = MQ2_BURST_FROZEN;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Set up TIM6 as the burst sample clock (not started)
+ * @param  None
+ * @retval None
+ */
+void MQ2_Burst_Init(void)
+{
+    __HAL_RCC_TIM6_CLK_ENABLE();
+
+    // TIM6 runs from 2 x PCLK1 = 64 MHz
+    htim6.Instance = TIM6;
+    htim6.Init.Prescaler = (HAL_RCC_GetPCLK1Freq() * 2 / MQ2_BURST_TIMER_HZ) - 1;
+    htim6.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim6.Init.Period = (MQ2_BURST_TIMER_HZ / burst_rate_hz) - 1;
+    htim6.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    HAL_TIM_Base_Init(&htim6);
+
+    HAL_NVIC_SetPriority(TIM6_DAC1_IRQn, MQ2_BURST_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(TIM6_DAC1_IRQn);
+
+    burst_state = MQ2_BURST_IDLE;
+    burst_count = 0;
+}
+
+/**
+ * @brief  Start filling the pre-trigger ring (discards a frozen capture)
+ * @param  None
+ * @retval HAL status
+ */
+HAL_StatusTypeDef MQ2_Burst_Arm(void)
+{
+    // Sampling must not start before the ADC bring-up (MQ2_Init) has run
+    if (htim6.Instance == NULL)
+        return HAL_ERROR;
+
+    HAL_TIM_Base_Stop_IT(&htim6);
+
+    uint32_t period = MQ2_BURST_TIMER_HZ / burst_rate_hz;
+    burst_actual_hz = (uint16_t)(MQ2_BURST_TIMER_HZ / period);
+
+    // Windows in samples; the post-trigger window has priority for ring space
+    uint32_t post = ((uint32_t)burst_post_ms * burst_actual_hz + 999) / 1000;
+    uint32_t pre = ((uint32_t)burst_pre_ms * burst_actual_hz) / 1000;
+    if (post == 0)
+        post = 1;
+    if (post > MQ2_BURST_DEPTH)
+        post = MQ2_BURST_DEPTH;
+    if (pre > MQ2_BURST_DEPTH - post)
+        pre = MQ2_BURST_DEPTH - post;
+
+    burst_pre = (uint16_t)pre;
+    burst_post = (uint16_t)post;
+    burst_wr = 0;
+    burst_filled = 0;
+    burst_count = 0;
+    burst_overruns = 0;
+
+    __HAL_TIM_SET_AUTORELOAD(&htim6, period - 1);
+    __HAL_TIM_SET_COUNTER(&htim6, 0);
+
+    burst_state = MQ2_BURST_ARMED;
+    return HAL_TIM_Base_Start_IT(&htim6);
+}
+
+/**
+ * @brief  Stop sampling and return to idle (a frozen capture is dropped)
+ * @param  None
+ * @retval None
+ */
+void MQ2_Burst_Disarm(void)
+{
+    if (htim6.Instance != NULL)
+        HAL_TIM_Base_Stop_IT(&htim6);
+    burst_state = MQ2_BURST_IDLE;
+    burst_count = 0;
+}
+
+/**
+ * @brief  Trigger a capture; arms first if the burst is not already armed
+ * @param  None
+ * @retval None
+ */
+void MQ2_Burst_Trigger(void)
+{
+    if (burst_state == MQ2_BURST_IDLE || burst_state == MQ2_BURST_FROZEN)
+    {
+        if (MQ2_Burst_Arm() != HAL_OK)
+            return;
+    }
+
+    if (burst_state == MQ2_BURST_ARMED)
+    {
+        burst_remaining = burst_post;
+        burst_state = MQ2_BURST_TRIGGERED;
+    }
+}
+
+/**
+ * @brief  Trigger on a rising edge of any selected alarm rule
+ * @param  active_mask: Alarm rules currently active (bit n = rule n)
+ * @retval None
+ * @note   Alarm triggers only fire while armed, so a frozen capture is kept.
+ */
+void MQ2_Burst_CheckAlarms(uint8_t active_mask)
+{
+    uint8_t rising = active_mask & ~burst_prev_alarms;
+    burst_prev_alarms = active_mask;
+
+    if ((rising & burst_alarm_mask) && burst_state == MQ2_BURST_ARMED)
+    {
+        MQ2_Burst_Trigger();
+    }
+}
+
+/**
+ * @brief  Check whether the burst owns the ADC
+ * @param  None
+ * @retval 1 while armed or recording the post-trigger window
+ */
+uint8_t MQ2_Burst_IsSampling(void)
+{
+    return (burst_state == MQ2_BURST_ARMED || burst_state == MQ2_BURST_TRIGGERED);
+}
+
+/**
+ * @brief  TIM6 update: start the next ADC scan
+ * @param  None
+ * @retval None
+ */
+void MQ2_Burst_TimerTick(void)
+{
+    if (MQ2_StartScan() != HAL_OK)
+    {
+        burst_overruns++;
+    }
+}
+
+/**
+ * @brief  Store one completed scan (ADC DMA interrupt)
+ * @param  scan: ADC scan buffer, MQ2 CH0-CH3 first
+ * @retval None
+ */
+void MQ2_Burst_OnScan(const uint16_t *scan)
+{
+    if (!MQ2_Burst_IsSampling())
+        return;
+
+    memcpy(burst_ring[burst_wr], scan, sizeof(burst_ring[0]));
+    burst_wr = (burst_wr + 1) % MQ2_BURST_DEPTH;
+    if (burst_filled < MQ2_BURST_DEPTH)
+        burst_filled++;
+
+    if (burst_state == MQ2_BURST_TRIGGERED && --burst_remaining == 0)
+    {
+        MQ2_Burst_Freeze();
+    }
+}
+
+/**
+ * @brief  Read a burst register
+ * @param  reg: Register
+ * @retval Register value
+ */
+uint16_t MQ2_Burst_ReadRegister(MQ2_BurstReg_t reg)
+{
+    switch (reg)
+    {
+    case MQ2_BURST_REG_RATE:
+        return burst_rate_hz;
+    case MQ2_BURST_REG_PRE_MS:
+        return burst_pre_ms;
+    case MQ2_BURST_REG_POST_MS:
+        return burst_post_ms;
+    case MQ2_BURST_REG_ALARM_MASK:
+        return burst_alarm_mask;
+    case MQ2_BURST_REG_STATE:
+        return burst_state;
+    case MQ2_BURST_REG_SAMPLES:
+        return burst_count;
+    case MQ2_BURST_REG_TRIGGER_IDX:
+        return burst_trigger_idx;
+    case MQ2_BURST_REG_ACTUAL_RATE:
+        return burst_actual_hz;
+    case MQ2_BURST_REG_CAPTURES:
+        return burst_captures;
+    case MQ2_BURST_REG_OVERRUNS:
+        return burst_overruns;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief  Write a burst configuration register
+ * @param  reg: Register (only the first four are writable)
+ * @param  value: New value
+ * @retval HAL_BUSY while sampling, HAL_ERROR for read-only or invalid values
+ */
+HAL_StatusTypeDef MQ2_Burst_WriteRegister(MQ2_BurstReg_t reg, uint16_t value)
+{
+    if (reg > MQ2_BURST_REG_ALARM_MASK)
+        return HAL_ERROR;
+
+    // Windows are converted to samples when arming; keep them fixed meanwhile
+    if (MQ2_Burst_IsSampling())
+        return HAL_BUSY;
+
+    switch (reg)
+    {
+    case MQ2_BURST_REG_RATE:
+        if (value < MQ2_BURST_RATE_MIN_HZ || value > MQ2_BURST_RATE_MAX_HZ)
+            return HAL_ERROR;
+        burst_rate_hz = value;
+        break;
+    case MQ2_BURST_REG_PRE_MS:
+        burst_pre_ms = value;
+        break;
+    case MQ2_BURST_REG_POST_MS:
+        burst_post_ms = value;
+        break;
+    default:
+        if (value > 0xFF)
+            return HAL_ERROR;
+        burst_alarm_mask = (uint8_t)value;
+        break;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief  Read one FC20 record of the frozen capture
+ * @param  file: MQ2_BURST_FILE_HEADER or MQ2_BURST_FILE_CH0 + channel
+ * @param  record: Register index within the file
+ * @param  value: Register value
+ * @retval HAL_BUSY until a capture is frozen, HAL_ERROR out of range
+ */
+HAL_StatusTypeDef MQ2_Burst_ReadRecord(uint16_t file, uint16_t record, uint16_t *value)
+{
+    if (file == MQ2_BURST_FILE_HEADER)
+    {
+        if (record >= MQ2_BURST_REG_COUNT)
+            return HAL_ERROR;
+        *value = MQ2_Burst_ReadRegister((MQ2_BurstReg_t)record);
+        return HAL_OK;
+    }
+
+    if (file < MQ2_BURST_FILE_CH0 || file >= MQ2_BURST_FILE_CH0 + MQ2_NUM_CHANNELS)
+        return HAL_ERROR;
+    if (burst_state != MQ2_BURST_FROZEN)
+        return HAL_BUSY;
+    if (record >= burst_count)
+        return HAL_ERROR;
+
+    *value = burst_ring[(burst_start + record) % MQ2_BURST_DEPTH][file - MQ2_BURST_FILE_CH0];
+    return HAL_OK;
+}
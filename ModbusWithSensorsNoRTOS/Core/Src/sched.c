@@ -0,0 +1,220 @@
+/**
+ * @file    sched.c
+ * @brief   Cooperative earliest-deadline-first task scheduler
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * Every task is released at phase + k * period. Of the released tasks the
+ * one with the earliest absolute deadline runs to completion; nothing is
+ * preempted, so a task's execution time adds to the latency of the others.
+ * A run that ends after its deadline counts as an overrun, and releases
+ * whose deadline passed meanwhile are dropped rather than run back to back,
+ * which keeps every task on its original phase after a stall. A task can
+ * also be asked for one extra run (Sched_Request, e.g. from a Modbus write);
+ * that run is due at once and leaves the periodic releases where they were.
+ *
+ * The core has no HAL dependency: time comes from the Sched_Clock_t given
+ * to Sched_Init, so it can be driven by a virtual clock off-target.
+ */
+
+#include "sched.h"
+#include <stddef.h>
+
+/* Private variables ---------------------------------------------------------*/
+static Sched_Task_t *sched_tasks;
+static uint8_t sched_count;
+static const Sched_Clock_t *sched_clock;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t Sched_Saturate(uint32_t value);
+static void Sched_Account(Sched_Task_t *t, uint32_t start, uint32_t end, uint32_t cycles, uint8_t released);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Clamp a value to a 16-bit register
+ * @param  value: Value
+ * @retval value, or 0xFFFF if it does not fit
+ */
+static uint16_t Sched_Saturate(uint32_t value)
+{
+    return (value > 0xFFFF) ? 0xFFFF : (uint16_t)value;
+}
+
+/**
+ * @brief  Record a completed run and schedule the next release
+ * @param  t: Task that ran
+ * @param  start: Tick the run started
+ * @param  end: Tick the run finished
+ * @param  cycles: Execution time in clock cycles
+ * @param  released: 0 for an extra run, which leaves the releases alone
+ * @retval None
+ */
+static void Sched_Account(Sched_Task_t *t, uint32_t start, uint32_t end, uint32_t cycles, uint8_t released)
+{
+    uint32_t deadline_ms = t->deadline_ms ? t->deadline_ms : t->period_ms;
+    uint16_t run_us = Sched_Saturate(cycles / sched_clock->cycles_per_us);
+    uint16_t late_ms = Sched_Saturate(start - t->release);
+
+    t->runs++;
+    t->last_us = run_us;
+    if (run_us > t->wcet_us)
+        t->wcet_us = run_us;
+    if (!released)
+        return;
+    if (late_ms > t->max_late_ms)
+        t->max_late_ms = late_ms;
+    if ((int32_t)(end - (t->release + deadline_ms)) > 0 && t->overruns < 0xFFFF)
+        t->overruns++;
+
+    // Drop the releases whose deadline is already behind us
+    t->release += t->period_ms;
+    if ((int32_t)(end - (t->release + deadline_ms)) >= 0)
+    {
+        uint32_t missed = (end - (t->release + deadline_ms)) / t->period_ms + 1;
+        t->release += missed * t->period_ms;
+        t->skipped = Sched_Saturate((uint32_t)t->skipped + missed);
+    }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Take over a task table and release each task after its phase
+ * @param  tasks: Task table, run/period/phase/deadline filled in
+ * @param  count: Number of tasks
+ * @param  clock: Time base (must outlive the scheduler)
+ * @retval None
+ */
+void Sched_Init(Sched_Task_t *tasks, uint8_t count, const Sched_Clock_t *clock)
+{
+    uint32_t now = clock->now_ms();
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        Sched_Task_t *t = &tasks[i];
+
+        if (t->period_ms == 0)
+            t->period_ms = 1;
+        t->release = now + t->phase_ms;
+        t->runs = 0;
+        t->last_us = 0;
+        t->wcet_us = 0;
+        t->max_late_ms = 0;
+        t->overruns = 0;
+        t->skipped = 0;
+        t->requested = 0;
+    }
+
+    sched_tasks = tasks;
+    sched_count = count;
+    sched_clock = clock;
+}
+
+/**
+ * @brief  Run the released task with the earliest deadline, if any (main loop)
+ * @param  None
+ * @retval 1 if a task ran, 0 if nothing was due
+ */
+uint8_t Sched_RunNext(void)
+{
+    if (sched_tasks == NULL)
+        return 0;
+
+    uint32_t now = sched_clock->now_ms();
+    Sched_Task_t *next = NULL;
+    uint32_t next_deadline = 0;
+
+    for (uint8_t i = 0; i < sched_count; i++)
+    {
+        Sched_Task_t *t = &sched_tasks[i];
+        uint32_t relative = t->deadline_ms ? t->deadline_ms : t->period_ms;
+        uint32_t deadline;
+
+        if ((int32_t)(now - t->release) >= 0)
+            deadline = t->release + relative;
+        else if (t->requested)
+            deadline = now + relative;
+        else
+            continue;
+
+        // Ties go to the lower index, so table order is the fallback priority
+        if (next == NULL || (int32_t)(deadline - next_deadline) < 0)
+        {
+            next = t;
+            next_deadline = deadline;
+        }
+    }
+
+    if (next == NULL)
+        return 0;
+
+    // A request that arrives while the task runs gets a run of its own
+    uint8_t released = (int32_t)(now - next->release) >= 0;
+    next->requested = 0;
+
+    uint32_t c0 = sched_clock->now_cycles();
+    next->run();
+    uint32_t cycles = sched_clock->now_cycles() - c0;
+
+    Sched_Account(next, now, sched_clock->now_ms(), cycles, released);
+    return 1;
+}
+
+/**
+ * @brief  Change a task period; takes effect from the next release
+ * @param  task: Task index
+ * @param  period_ms: New period (ms), 0 is ignored
+ * @retval None
+ */
+void Sched_SetPeriod(uint8_t task, uint32_t period_ms)
+{
+    if (task < sched_count && period_ms > 0)
+        sched_tasks[task].period_ms = period_ms;
+}
+
+/**
+ * @brief  Ask for one extra run of a task as soon as possible (any context)
+ * @param  task: Task index
+ * @retval None
+ * @note   The run is scheduled with the task's relative deadline from now and
+ *         does not move its periodic releases. A due release covers it.
+ */
+void Sched_Request(uint8_t task)
+{
+    if (task < sched_count)
+        sched_tasks[task].requested = 1;
+}
+
+/**
+ * @brief  Read one register of a task record (Modbus ISR)
+ * @param  task: Task index
+ * @param  reg: Register within the record
+ * @retval Register value
+ */
+uint16_t Sched_ReadRegister(uint8_t task, Sched_Reg_t reg)
+{
+    if (task >= sched_count)
+        return 0;
+
+    const Sched_Task_t *t = &sched_tasks[task];
+
+    switch (reg)
+    {
+    case SCHED_REG_PERIOD_MS:
+        return Sched_Saturate(t->period_ms);
+    case SCHED_REG_RUNS:
+        return (uint16_t)t->runs;
+    case SCHED_REG_LAST_US:
+        return t->last_us;
+    case SCHED_REG_WCET_US:
+        return t->wcet_us;
+    case SCHED_REG_MAX_LATE_MS:
+        return t->max_late_ms;
+    case SCHED_REG_OVERRUNS:
+        return t->overruns;
+    case SCHED_REG_SKIPPED:
+        return t->skipped;
+    default:
+        return 0;
+    }
+}
@@ -0,0 +1,353 @@
+/**
+ * @file    stats.c
+ * @brief   Sliding-window min/max/mean/stddev per sensor channel
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * Each window is split into STATS_BUCKETS buckets of window/STATS_BUCKETS
+ * seconds. Samples go into the open bucket with Welford's update. When the
+ * bucket closes, the window's mean and variance are the pairwise (Chan)
+ * merge of the last STATS_BUCKETS closed buckets. Min and max come from
+ * monotonic deques of bucket extrema, so a sample costs O(1) and a bucket
+ * close costs O(STATS_BUCKETS).
+ *
+ * A channel only takes a sample while Health_ReadValueQuality() reports it
+ * good, so bring-up zeros, error sentinels and failed reads never count.
+ * Temperature is a signed register and is accumulated as int16_t.
+ *
+ * The published snapshot only changes when a bucket closes. A master
+ * therefore reads a stable block and can poll it at the bucket rate.
+ */
+
+#include "stats.h"
+#include "health.h"
+#include "modbus_device.h"
+#include <math.h>
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+    float mean;
+    float m2; // Sum of squared deviations from the mean
+    uint16_t n;
+} Stats_Bucket_t;
+
+typedef struct
+{
+    uint8_t seq[STATS_BUCKETS]; // Bucket sequence number of each entry
+    int32_t value[STATS_BUCKETS];
+    uint8_t head;
+    uint8_t len;
+} Stats_Deque_t;
+
+typedef struct
+{
+    Stats_Bucket_t open;                  // Bucket being filled
+    int32_t open_min;
+    int32_t open_max;
+    Stats_Bucket_t closed[STATS_BUCKETS]; // Ring of the last closed buckets
+    Stats_Deque_t min_q;                  // Increasing bucket minima
+    Stats_Deque_t max_q;                  // Decreasing bucket maxima
+} Stats_Channel_t;
+
+typedef struct
+{
+    uint16_t window_s;
+    uint8_t seq;           // Sequence number of the open bucket
+    uint8_t slot;          // Ring slot the open bucket closes into
+    uint32_t bucket_start; // Tick when the open bucket started
+    Stats_Channel_t ch[STATS_NUM_CHANNELS];
+} Stats_Window_t;
+
+/* Private variables ---------------------------------------------------------*/
+// Source registers, read after the 1 Hz update has mapped them
+static const uint16_t stats_sources[STATS_NUM_CHANNELS] = {
+    40005, 40006, 40007, 40008, // MQ2 CH0-CH3 mV
+    40013, 40014, 40015};       // CO2, temperature, humidity
+
+// 1 where the source register holds an int16_t (temperature °C × 100)
+static const uint8_t stats_signed[STATS_NUM_CHANNELS] = {0, 0, 0, 0, 0, 1, 0};
+
+static Stats_Window_t stats_window[STATS_NUM_WINDOWS];
+static volatile uint16_t stats_pending_s[STATS_NUM_WINDOWS]; // Window lengths written over Modbus, 0 = none
+
+// Published snapshots, read by the Modbus ISR
+static uint16_t stats_snapshot[STATS_NUM_WINDOWS][STATS_REG_COUNT];
+
+/* Private function prototypes -----------------------------------------------*/
+static void Stats_ResetWindow(uint8_t w, uint16_t window_s, uint32_t now);
+static void Stats_DequePush(Stats_Deque_t *q, uint8_t seq, int32_t value, uint8_t is_max);
+static void Stats_DequeExpire(Stats_Deque_t *q, uint8_t seq);
+static void Stats_Merge(Stats_Bucket_t *acc, const Stats_Bucket_t *b);
+static void Stats_CloseBucket(uint8_t w);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Clear a window and start its first bucket
+ * @param  w: Window index
+ * @param  window_s: Window length (s)
+ * @param  now: Current tick (ms)
+ * @retval None
+ */
+static void Stats_ResetWindow(uint8_t w, uint16_t window_s, uint32_t now)
+{
+    Stats_Window_t *win = &stats_window[w];
+
+    memset(win, 0, sizeof(*win));
+    win->window_s = window_s;
+    win->bucket_start = now;
+
+    uint16_t snap[STATS_REG_COUNT] = {0};
+    snap[STATS_REG_WINDOW_S] = window_s;
+    snap[STATS_REG_UPDATES] = stats_snapshot[w][STATS_REG_UPDATES] + 1;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memcpy(stats_snapshot[w], snap, sizeof(snap));
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Push a bucket extreme onto a monotonic deque
+ * @param  q: Deque
+ * @param  seq: Bucket sequence number
+ * @param  value: Bucket minimum (min deque) or maximum (max deque)
+ * @param  is_max: 1 for the max deque
+ * @retval None
+ * @note   Entries the new value dominates can never be the extreme again.
+ */
+static void Stats_DequePush(Stats_Deque_t *q, uint8_t seq, int32_t value, uint8_t is_max)
+{
+    while (q->len > 0)
+    {
+        uint8_t back = (q->head + q->len - 1) % STATS_BUCKETS;
+        if (is_max ? (q->value[back] > value) : (q->value[back] < value))
+            break;
+        q->len--;
+    }
+
+    uint8_t slot = (q->head + q->len) % STATS_BUCKETS;
+    q->seq[slot] = seq;
+    q->value[slot] = value;
+    q->len++;
+}
+
+/**
+ * @brief  Drop deque entries that slid out of the window
+ * @param  q: Deque
+ * @param  seq: Sequence number of the newest closed bucket
+ * @retval None
+ */
+static void Stats_DequeExpire(Stats_Deque_t *q, uint8_t seq)
+{
+    while (q->len > 0 && (uint8_t)(seq - q->seq[q->head]) >= STATS_BUCKETS)
+    {
+        q->head = (q->head + 1) % STATS_BUCKETS;
+        q->len--;
+    }
+}
+
+/**
+ * @brief  Merge accumulator b into acc (Chan et al. pairwise update)
+ * @param  acc: Accumulator, updated in place
+ * @param  b: Accumulator to add
+ * @retval None
+ */
+static void Stats_Merge(Stats_Bucket_t *acc, const Stats_Bucket_t *b)
+{
+    if (b->n == 0)
+        return;
+    if (acc->n == 0)
+    {
+        *acc = *b;
+        return;
+    }
+
+    float n = (float)acc->n + (float)b->n;
+    float delta = b->mean - acc->mean;
+
+    acc->mean += delta * (float)b->n / n;
+    acc->m2 += b->m2 + delta * delta * (float)acc->n * (float)b->n / n;
+    acc->n += b->n;
+}
+
+/**
+ * @brief  Close the open bucket of a window and publish its snapshot
+ * @param  w: Window index
+ * @retval None
+ */
+static void Stats_CloseBucket(uint8_t w)
+{
+    Stats_Window_t *win = &stats_window[w];
+    uint16_t snap[STATS_REG_COUNT];
+    uint16_t samples = 0;
+
+    for (uint8_t c = 0; c < STATS_NUM_CHANNELS; c++)
+    {
+        Stats_Channel_t *ch = &win->ch[c];
+        Stats_Bucket_t total = {0};
+
+        // Expire first so the deque always has room for the new bucket
+        ch->closed[win->slot] = ch->open;
+        Stats_DequeExpire(&ch->min_q, win->seq);
+        Stats_DequeExpire(&ch->max_q, win->seq);
+        if (ch->open.n > 0)
+        {
+            Stats_DequePush(&ch->min_q, win->seq, ch->open_min, 0);
+            Stats_DequePush(&ch->max_q, win->seq, ch->open_max, 1);
+        }
+        memset(&ch->open, 0, sizeof(ch->open));
+
+        for (uint8_t b = 0; b < STATS_BUCKETS; b++)
+        {
+            Stats_Merge(&total, &ch->closed[b]);
+        }
+
+        // Signed channels go back out as int16_t two's complement
+        uint16_t *f = &snap[STATS_REG_CHANNELS + c * STATS_FIELD_COUNT];
+        f[STATS_FIELD_MEAN] = (uint16_t)(int32_t)floorf(total.mean + 0.5f);
+        f[STATS_FIELD_STDDEV] = total.n ? (uint16_t)(sqrtf(total.m2 / (float)total.n) + 0.5f) : 0;
+        f[STATS_FIELD_MIN] = ch->min_q.len ? (uint16_t)ch->min_q.value[ch->min_q.head] : 0;
+        f[STATS_FIELD_MAX] = ch->max_q.len ? (uint16_t)ch->max_q.value[ch->max_q.head] : 0;
+        if (total.n > samples)
+            samples = total.n;
+    }
+
+    snap[STATS_REG_WINDOW_S] = win->window_s;
+    snap[STATS_REG_SAMPLES] = samples;
+    snap[STATS_REG_UPDATES] = stats_snapshot[w][STATS_REG_UPDATES] + 1;
+
+    // Publish the whole block at once so a read never mixes two snapshots
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memcpy(stats_snapshot[w], snap, sizeof(snap));
+    __set_PRIMASK(primask);
+
+    win->seq++;
+    win->slot = (win->slot + 1) % STATS_BUCKETS;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Start all windows empty with the default lengths
+ * @param  None
+ * @retval None
+ */
+void Stats_Init(void)
+{
+    static const uint16_t defaults[STATS_NUM_WINDOWS] = STATS_DEFAULT_WINDOWS_S;
+    uint32_t now = HAL_GetTick();
+
+    memset(stats_snapshot, 0, sizeof(stats_snapshot));
+    for (uint8_t w = 0; w < STATS_NUM_WINDOWS; w++)
+    {
+        stats_pending_s[w] = 0;
+        Stats_ResetWindow(w, defaults[w], now);
+    }
+}
+
+/**
+ * @brief  Add the current good register values to every window (after each update)
+ * @param  None
+ * @retval None
+ */
+void Stats_Update(void)
+{
+    uint32_t now = HAL_GetTick();
+    int32_t values[STATS_NUM_CHANNELS];
+    uint8_t good[STATS_NUM_CHANNELS];
+
+    for (uint8_t c = 0; c < STATS_NUM_CHANNELS; c++)
+    {
+        uint16_t raw = Modbus_Device_Read(stats_sources[c]);
+
+        good[c] = Health_ReadValueQuality(stats_sources[c] - 40001) == HEALTH_QUALITY_GOOD;
+        values[c] = stats_signed[c] ? (int16_t)raw : raw;
+    }
+
+    for (uint8_t w = 0; w < STATS_NUM_WINDOWS; w++)
+    {
+        Stats_Window_t *win = &stats_window[w];
+
+        if (stats_pending_s[w])
+        {
+            Stats_ResetWindow(w, stats_pending_s[w], now);
+            stats_pending_s[w] = 0;
+        }
+
+        // Close every bucket that ended before this sample; after a long stall
+        // at most a full window of empty buckets is needed to flush it
+        uint32_t bucket_ms = (uint32_t)win->window_s * 1000 / STATS_BUCKETS;
+        for (uint8_t i = 0; i <= STATS_BUCKETS && (now - win->bucket_start) >= bucket_ms; i++)
+        {
+            Stats_CloseBucket(w);
+            win->bucket_start += bucket_ms;
+        }
+        if ((now - win->bucket_start) >= bucket_ms)
+            win->bucket_start = now;
+
+        for (uint8_t c = 0; c < STATS_NUM_CHANNELS; c++)
+        {
+            if (!good[c])
+                continue;
+
+            Stats_Channel_t *ch = &win->ch[c];
+            Stats_Bucket_t *acc = &ch->open;
+            float x = (float)values[c];
+
+            if (acc->n == 0 || values[c] < ch->open_min)
+                ch->open_min = values[c];
+            if (acc->n == 0 || values[c] > ch->open_max)
+                ch->open_max = values[c];
+
+            // Welford: numerically stable running mean and squared deviations
+            acc->n++;
+            float delta = x - acc->mean;
+            acc->mean += delta / (float)acc->n;
+            acc->m2 += delta * (x - acc->mean);
+        }
+    }
+}
+
+/**
+ * @brief  Read one snapshot register (Modbus ISR)
+ * @param  window: Window index
+ * @param  reg: Register within the window block
+ * @retval Register value
+ */
+uint16_t Stats_ReadSnapshot(uint8_t window, uint16_t reg)
+{
+    if (window >= STATS_NUM_WINDOWS || reg >= STATS_REG_COUNT)
+        return 0;
+    return stats_snapshot[window][reg];
+}
+
+/**
+ * @brief  Get the configured length of a window
+ * @param  window: Window index
+ * @retval Window length (s)
+ */
+uint16_t Stats_GetWindow(uint8_t window)
+{
+    if (window >= STATS_NUM_WINDOWS)
+        return 0;
+    return stats_pending_s[window] ? stats_pending_s[window] : stats_window[window].window_s;
+}
+
+/**
+ * @brief  Change a window length (Modbus ISR); the window restarts empty
+ * @param  window: Window index
+ * @param  seconds: New length (s)
+ * @retval HAL_ERROR if the length is out of range
+ */
+HAL_StatusTypeDef Stats_SetWindow(uint8_t window, uint16_t seconds)
+{
+    if (window >= STATS_NUM_WINDOWS || seconds < STATS_WINDOW_MIN_S || seconds > STATS_WINDOW_MAX_S)
+        return HAL_ERROR;
+
+    // Applied by the main loop on the next update
+    stats_pending_s[window] = seconds;
+    return HAL_OK;
+}
@@ -62,6 +62,7 @@ extern DMA_HandleTypeDef hdma_usart1_rx;
 extern DMA_HandleTypeDef hdma_usart1_tx;
 extern UART_HandleTypeDef huart1;
 /* USER CODE BEGIN EV */
+extern TIM_HandleTypeDef htim6;
 
 /* USER CODE END EV */
 
@@ -289,4 +290,20 @@ void USART1_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles EXTI line0 interrupt (SCD30 RDY on PB0).
+  */
+void EXTI0_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_0);
+}
+
+/**
+  * @brief This function handles TIM6 global and DAC1 underrun interrupts (MQ2 burst clock).
+  */
+void TIM6_DAC1_IRQHandler(void)
+{
+  HAL_TIM_IRQHandler(&htim6);
+}
+
 /* USER CODE END 1 */
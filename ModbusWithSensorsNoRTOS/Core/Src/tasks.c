@@ -0,0 +1,82 @@
+/**
+ * @file    tasks.c
+ * @brief   Periodic application tasks run by the cooperative scheduler
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * Each job that used to run on the single 1 s timer flag is its own task
+ * with its own period. Phases stagger the 1 s tasks so sampling, mapping
+ * and trend recording happen in that order within the same second without
+ * stacking up on one tick. Execution time is measured with the DWT cycle
+ * counter; releases and deadlines use the HAL millisecond tick.
+ */
+
+#include "tasks.h"
+#include "history.h"
+#include "modbus_device.h"
+#include "sensors.h"
+#include "stats.h"
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Tasks_CycleCount(void);
+static void Task_Publish(void);
+static void Task_Trend(void);
+
+/* Private variables ---------------------------------------------------------*/
+static Sched_Clock_t tasks_clock = {HAL_GetTick, Tasks_CycleCount, 1};
+
+// run, period, phase, deadline (0 = period)
+static Sched_Task_t tasks[TASK_COUNT] = {
+    [TASK_MQ2] = {Sensors_UpdateMQ2, 1000, 0, 0},
+    [TASK_SCD30] = {Sensors_UpdateSCD30, 2000, 500, 0}, // Follows the SCD30 interval (40101)
+    [TASK_PUBLISH] = {Task_Publish, 1000, 20, 200},     // Fresh values shortly after the MQ2 scan
+    [TASK_TREND] = {Task_Trend, 1000, 40, 0},
+    [TASK_DIAG] = {Modbus_Device_UpdateDiagnostics, 5000, 60, 0},
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Cycle counter for execution time measurement
+ * @param  None
+ * @retval DWT cycle count (wraps every 67 s at 64 MHz)
+ */
+static uint32_t Tasks_CycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief  Map sensor values to registers and evaluate alarms
+ * @param  None
+ * @retval None
+ */
+static void Task_Publish(void)
+{
+    Modbus_Device_UpdateSensors();
+}
+
+/**
+ * @brief  Record the published values in the history ring and statistics
+ * @param  None
+ * @retval None
+ */
+static void Task_Trend(void)
+{
+    History_Append();
+    Stats_Update();
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Release all tasks
+ * @param  None
+ * @retval None
+ * @note   Call after the sensors, history and statistics are initialised.
+ *         The cycle counter runs since Trace_Init().
+ */
+void Tasks_Init(void)
+{
+    tasks_clock.cycles_per_us = SystemCoreClock / 1000000;
+    Sched_Init(tasks, TASK_COUNT, &tasks_clock);
+}
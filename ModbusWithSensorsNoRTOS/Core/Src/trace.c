@@ -0,0 +1,188 @@
+/**
+ * @file    trace.c
+ * @brief   In-RAM binary event trace with DWT cycle timestamps
+ * @author  Integration for ModbusWithSensorsNoRTOS
+ *
+ * Interrupt handlers and the main loop log events into one ring without any
+ * formatting: a slot is claimed with a single LDREX/STREX increment of the
+ * write index, so an interrupt that preempts a writer takes the next slot
+ * instead of corrupting the current one, and no interrupt is ever masked.
+ * A record is a handful of loads and stores, cheap enough to leave in the
+ * timing-critical paths that used to be debugged by toggling GPIOs.
+ *
+ * The master reads the ring with FC20 after freezing it with coil 00008;
+ * tools/trace_decode.py turns the dump into a timeline and per-event
+ * latency histograms.
+ */
+
+#include "trace.h"
+
+/* Private variables ---------------------------------------------------------*/
+#if TRACE_ENABLE
+static Trace_Record_t trace_ring[TRACE_DEPTH];
+static volatile uint32_t trace_head; // Events recorded since boot; slot = head % TRACE_DEPTH
+static volatile uint8_t trace_frozen;
+static uint32_t trace_dump_head; // trace_head when the ring was frozen
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Start the DWT cycle counter used for the timestamps
+ * @param  None
+ * @retval None
+ * @note   Call first in main() so peripheral bring-up is traced too. This is
+ *         the only place the counter is started and nothing resets it: the
+ *         scheduler, sleep accounting and request profiling read the same
+ *         free-running count, so trace timestamps stay in event order.
+ */
+void Trace_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if TRACE_ENABLE
+    trace_head = 0;
+    trace_frozen = 0;
+#endif
+}
+
+/**
+ * @brief  Record one event (any context)
+ * @param  id: Event id (Trace_Event_t)
+ * @param  arg: Event argument
+ * @retval None
+ */
+void Trace_Record(uint16_t id, uint16_t arg)
+{
+#if TRACE_ENABLE
+    uint32_t cycles = DWT->CYCCNT;
+    uint32_t slot;
+
+    if (trace_frozen)
+        return;
+
+    do
+    {
+        slot = __LDREXW(&trace_head);
+    } while (__STREXW(slot + 1, &trace_head) != 0);
+
+    Trace_Record_t *r = &trace_ring[slot % TRACE_DEPTH];
+    r->cycles = cycles;
+    r->id = id;
+    r->arg = arg;
+#else
+    (void)id;
+    (void)arg;
+#endif
+}
+
+/**
+ * @brief  Hold or release the ring (coil 00008)
+ * @param  frozen: 1 = stop recording so the master can read a stable ring
+ * @retval None
+ */
+void Trace_Freeze(uint8_t frozen)
+{
+#if TRACE_ENABLE
+    if (frozen && !trace_frozen)
+        trace_dump_head = trace_head;
+    trace_frozen = frozen ? 1 : 0;
+#else
+    (void)frozen;
+#endif
+}
+
+/**
+ * @brief  Check whether the ring is held for reading
+ * @param  None
+ * @retval 1 while frozen
+ */
+uint8_t Trace_IsFrozen(void)
+{
+#if TRACE_ENABLE
+    return trace_frozen;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief  FC20 access to the trace header and records
+ * @param  file: TRACE_FILE_HEADER or TRACE_FILE_RECORDS
+ * @param  record: Register number within the file (4 per event in the records file:
+ *                 id, arg, cycles high, cycles low)
+ * @param  value: Register value
+ * @retval HAL_OK, HAL_BUSY (records while not frozen) or HAL_ERROR (no such register)
+ */
+HAL_StatusTypeDef Trace_ReadRecord(uint16_t file, uint16_t record, uint16_t *value)
+{
+#if TRACE_ENABLE
+    uint32_t head = trace_frozen ? trace_dump_head : trace_head;
+    uint32_t valid = (head < TRACE_DEPTH) ? head : TRACE_DEPTH;
+
+    if (file == TRACE_FILE_HEADER)
+    {
+        switch (record)
+        {
+        case TRACE_REG_MAGIC:
+            *value = TRACE_MAGIC;
+            break;
+        case TRACE_REG_VERSION:
+            *value = TRACE_VERSION;
+            break;
+        case TRACE_REG_DEPTH:
+            *value = TRACE_DEPTH;
+            break;
+        case TRACE_REG_COUNT_HI:
+            *value = (uint16_t)(head >> 16);
+            break;
+        case TRACE_REG_COUNT_LO:
+            *value = (uint16_t)head;
+            break;
+        case TRACE_REG_VALID:
+            *value = (uint16_t)valid;
+            break;
+        case TRACE_REG_CLOCK_KHZ:
+            *value = (uint16_t)(SystemCoreClock / 1000);
+            break;
+        case TRACE_REG_FROZEN:
+            *value = trace_frozen;
+            break;
+        default:
+            return HAL_ERROR;
+        }
+        return HAL_OK;
+    }
+
+    if (file != TRACE_FILE_RECORDS)
+        return HAL_ERROR;
+    if (!trace_frozen)
+        return HAL_BUSY;
+    if (record / 4 >= valid)
+        return HAL_ERROR;
+
+    const Trace_Record_t *r = &trace_ring[(head - valid + record / 4) % TRACE_DEPTH];
+    switch (record % 4)
+    {
+    case 0:
+        *value = r->id;
+        break;
+    case 1:
+        *value = r->arg;
+        break;
+    case 2:
+        *value = (uint16_t)(r->cycles >> 16);
+        break;
+    default:
+        *value = (uint16_t)r->cycles;
+        break;
+    }
+    return HAL_OK;
+#else
+    (void)file;
+    (void)record;
+    (void)value;
+    return HAL_ERROR;
+#endif
+}
@@ -7,6 +7,8 @@
 #include "uart_callbacks.h"
 #include "modbus_init.h"
 #include "modbus.h"
+#include "modbus_prof.h"
+#include "trace.h"
 
 /* Private variables ---------------------------------------------------------*/
 extern UART_HandleTypeDef huart1;
@@ -38,20 +40,20 @@ void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
 {
     if (huart == &huart1 && Size > 0)
     {
+        MODBUS_PROF_MARK(MODBUS_PROF_RX, 0);
+
         // Get Modbus context
         mbus_t modbus_ctx = Modbus_GetContext();
 
         // Mark Modbus activity for recovery system
         ModbusRecovery_MarkActivity();
+        TRACE(TRACE_EV_FRAME_RX, Size);
 
         // Validate context before processing
         if (modbus_ctx >= 0)
         {
-            // Process received Modbus data byte by byte
-            for (uint16_t i = 0; i < Size && i < sizeof(modbus_rx_buffer); i++)
-            {
-                mbus_poll(modbus_ctx, modbus_rx_buffer[i]);
-            }
+            // An idle line ends the frame; parse it with a fresh parser
+            mbus_poll_frame(modbus_ctx, modbus_rx_buffer, Size);
         } // Clear the UART idle flag
         __HAL_UART_CLEAR_IDLEFLAG(huart);
 
@@ -71,6 +73,11 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
     {
         // Mark error for recovery system
         ModbusRecovery_MarkError();
+        TRACE(TRACE_EV_UART_ERROR, (uint16_t)huart->ErrorCode);
+
+        // Lost characters count towards FC08 sub-function 0x12
+        if (huart->ErrorCode & HAL_UART_ERROR_ORE)
+            mbus_char_overrun(Modbus_GetContext());
 
         // Handle UART errors
         __HAL_UART_CLEAR_OREFLAG(huart);
@@ -5,56 +5,77 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Core/Src/alarms.c \
+../Core/Src/boot.c \
+../Core/Src/history.c \
+../Core/Src/lowpower.c \
 ../Core/Src/main.c \
-../Core/Src/mbutils.c \
-../Core/Src/modbus.c \
 ../Core/Src/modbus_device.c \
 ../Core/Src/modbus_init.c \
-../Core/Src/sensors.c \
+../Core/Src/modbus_prof.c \
+../Core/Src/mq2_burst.c \
+../Core/Src/sched.c \
+../Core/Src/stats.c \
 ../Core/Src/stm32f3xx_hal_msp.c \
 ../Core/Src/stm32f3xx_it.c \
 ../Core/Src/syscalls.c \
 ../Core/Src/sysmem.c \
 ../Core/Src/system_stm32f3xx.c \
+../Core/Src/tasks.c \
+../Core/Src/trace.c \
 ../Core/Src/uart_callbacks.c 
 
 OBJS += \
+./Core/Src/alarms.o \
+./Core/Src/boot.o \
+./Core/Src/history.o \
+./Core/Src/lowpower.o \
 ./Core/Src/main.o \
-./Core/Src/mbutils.o \
-./Core/Src/modbus.o \
 ./Core/Src/modbus_device.o \
 ./Core/Src/modbus_init.o \
-./Core/Src/sensors.o \
+./Core/Src/modbus_prof.o \
+./Core/Src/mq2_burst.o \
+./Core/Src/sched.o \
+./Core/Src/stats.o \
 ./Core/Src/stm32f3xx_hal_msp.o \
 ./Core/Src/stm32f3xx_it.o \
 ./Core/Src/syscalls.o \
 ./Core/Src/sysmem.o \
 ./Core/Src/system_stm32f3xx.o \
+./Core/Src/tasks.o \
+./Core/Src/trace.o \
 ./Core/Src/uart_callbacks.o 
 
 C_DEPS += \
+./Core/Src/alarms.d \
+./Core/Src/boot.d \
+./Core/Src/history.d \
+./Core/Src/lowpower.d \
 ./Core/Src/main.d \
-./Core/Src/mbutils.d \
-./Core/Src/modbus.d \
 ./Core/Src/modbus_device.d \
 ./Core/Src/modbus_init.d \
-./Core/Src/sensors.d \
+./Core/Src/modbus_prof.d \
+./Core/Src/mq2_burst.d \
+./Core/Src/sched.d \
+./Core/Src/stats.d \
 ./Core/Src/stm32f3xx_hal_msp.d \
 ./Core/Src/stm32f3xx_it.d \
 ./Core/Src/syscalls.d \
 ./Core/Src/sysmem.d \
 ./Core/Src/system_stm32f3xx.d \
+./Core/Src/tasks.d \
+./Core/Src/trace.d \
 ./Core/Src/uart_callbacks.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
 Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
-	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/mbutils.cyclo ./Core/Src/mbutils.d ./Core/Src/mbutils.o ./Core/Src/mbutils.su ./Core/Src/modbus.cyclo ./Core/Src/modbus.d ./Core/Src/modbus.o ./Core/Src/modbus.su ./Core/Src/modbus_device.cyclo ./Core/Src/modbus_device.d ./Core/Src/modbus_device.o ./Core/Src/modbus_device.su ./Core/Src/modbus_init.cyclo ./Core/Src/modbus_init.d ./Core/Src/modbus_init.o ./Core/Src/modbus_init.su ./Core/Src/sensors.cyclo ./Core/Src/sensors.d ./Core/Src/sensors.o ./Core/Src/sensors.su ./Core/Src/stm32f3xx_hal_msp.cyclo ./Core/Src/stm32f3xx_hal_msp.d ./Core/Src/stm32f3xx_hal_msp.o ./Core/Src/stm32f3xx_hal_msp.su ./Core/Src/stm32f3xx_it.cyclo ./Core/Src/stm32f3xx_it.d ./Core/Src/stm32f3xx_it.o ./Core/Src/stm32f3xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f3xx.cyclo ./Core/Src/system_stm32f3xx.d ./Core/Src/system_stm32f3xx.o ./Core/Src/system_stm32f3xx.su ./Core/Src/uart_callbacks.cyclo ./Core/Src/uart_callbacks.d ./Core/Src/uart_callbacks.o ./Core/Src/uart_callbacks.su
+	-$(RM) ./Core/Src/alarms.cyclo ./Core/Src/alarms.d ./Core/Src/alarms.o ./Core/Src/alarms.su ./Core/Src/boot.cyclo ./Core/Src/boot.d ./Core/Src/boot.o ./Core/Src/boot.su ./Core/Src/history.cyclo ./Core/Src/history.d ./Core/Src/history.o ./Core/Src/history.su ./Core/Src/lowpower.cyclo ./Core/Src/lowpower.d ./Core/Src/lowpower.o ./Core/Src/lowpower.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/modbus_device.cyclo ./Core/Src/modbus_device.d ./Core/Src/modbus_device.o ./Core/Src/modbus_device.su ./Core/Src/modbus_init.cyclo ./Core/Src/modbus_init.d ./Core/Src/modbus_init.o ./Core/Src/modbus_init.su ./Core/Src/modbus_prof.cyclo ./Core/Src/modbus_prof.d ./Core/Src/modbus_prof.o ./Core/Src/modbus_prof.su ./Core/Src/mq2_burst.cyclo ./Core/Src/mq2_burst.d ./Core/Src/mq2_burst.o ./Core/Src/mq2_burst.su ./Core/Src/sched.cyclo ./Core/Src/sched.d ./Core/Src/sched.o ./Core/Src/sched.su ./Core/Src/stats.cyclo ./Core/Src/stats.d ./Core/Src/stats.o ./Core/Src/stats.su ./Core/Src/stm32f3xx_hal_msp.cyclo ./Core/Src/stm32f3xx_hal_msp.d ./Core/Src/stm32f3xx_hal_msp.o ./Core/Src/stm32f3xx_hal_msp.su ./Core/Src/stm32f3xx_it.cyclo ./Core/Src/stm32f3xx_it.d ./Core/Src/stm32f3xx_it.o ./Core/Src/stm32f3xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f3xx.cyclo ./Core/Src/system_stm32f3xx.d ./Core/Src/system_stm32f3xx.o ./Core/Src/system_stm32f3xx.su ./Core/Src/tasks.cyclo ./Core/Src/tasks.d ./Core/Src/tasks.o ./Core/Src/tasks.su ./Core/Src/trace.cyclo ./Core/Src/trace.d ./Core/Src/trace.o ./Core/Src/trace.su ./Core/Src/uart_callbacks.cyclo ./Core/Src/uart_callbacks.d ./Core/Src/uart_callbacks.o ./Core/Src/uart_callbacks.su
 
 .PHONY: clean-Core-2f-Src
 
@@ -25,4 +25,8 @@ SUBDIRS := \
 Core/Src \
 Core/Startup \
 Drivers/STM32F3xx_HAL_Driver/Src \
+stModbus/Src \
+stModbus/port/baremetal \
+stSensors/Src \
+stSensors/port/baremetal \
 
@@ -0,0 +1,30 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+# Toolchain: GNU Tools for STM32 (13.3.rel1)
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../../stModbus/Src/mbutils.c \
+../../stModbus/Src/modbus.c 
+
+OBJS += \
+./stModbus/Src/mbutils.o \
+./stModbus/Src/modbus.o 
+
+C_DEPS += \
+./stModbus/Src/mbutils.d \
+./stModbus/Src/modbus.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+stModbus/Src/%.o stModbus/Src/%.su stModbus/Src/%.cyclo: ../../stModbus/Src/%.c stModbus/Src/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+
+clean: clean-stModbus-2f-Src
+
+clean-stModbus-2f-Src:
+	-$(RM) ./stModbus/Src/mbutils.cyclo ./stModbus/Src/mbutils.d ./stModbus/Src/mbutils.o ./stModbus/Src/mbutils.su ./stModbus/Src/modbus.cyclo ./stModbus/Src/modbus.d ./stModbus/Src/modbus.o ./stModbus/Src/modbus.su
+
+.PHONY: clean-stModbus-2f-Src
+
@@ -0,0 +1,27 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+# Toolchain: GNU Tools for STM32 (13.3.rel1)
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../../stModbus/port/baremetal/mbport.c 
+
+OBJS += \
+./stModbus/port/baremetal/mbport.o 
+
+C_DEPS += \
+./stModbus/port/baremetal/mbport.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+stModbus/port/baremetal/%.o stModbus/port/baremetal/%.su stModbus/port/baremetal/%.cyclo: ../../stModbus/port/baremetal/%.c stModbus/port/baremetal/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../../stSensors/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+
+clean: clean-stModbus-2f-port-2f-baremetal
+
+clean-stModbus-2f-port-2f-baremetal:
+	-$(RM) ./stModbus/port/baremetal/mbport.cyclo ./stModbus/port/baremetal/mbport.d ./stModbus/port/baremetal/mbport.o ./stModbus/port/baremetal/mbport.su
+
+.PHONY: clean-stModbus-2f-port-2f-baremetal
+
@@ -0,0 +1,14 @@
+/**
+ * @file    modbus_device.h
+ * @brief   Host stand-in: the register read the tested modules sample
+ */
+
+#ifndef __MODBUS_DEVICE_H
+#define __MODBUS_DEVICE_H
+
+#include <stdint.h>
+
+/* Provided by the test */
+uint16_t Modbus_Device_Read(uint32_t logical_address);
+
+#endif /* __MODBUS_DEVICE_H */
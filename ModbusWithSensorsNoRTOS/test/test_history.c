@@ -0,0 +1,401 @@
+/**
+ * @file    test_history.c
+ * @brief   Host round-trip test and benchmark of the history encoding
+ *
+ * Records go in through History_Append() and come back out through the
+ * history registers, decoded the way INTEGRATION_GUIDE.md tells a master to
+ * ("History Ring"). Every decoded record must equal what was appended, and
+ * the encoded sizes must step exactly at the varint boundaries: zig-zag
+ * deltas of 63/-64 fit one byte, 64/-65 need two, 8191/-8192 two, 8192/-8193
+ * three; the same for the time delta and the change mask.
+ *
+ * The benchmark replays three simulated one-hour traces at 1 Hz and prints
+ * the figures tabulated in the guide.
+ */
+
+#include "history.h"
+#include "modbus_device.h"
+#include "test.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private constants */
+#define TRACE_RECORDS 3600 // One hour at 1 Hz
+#define MAX_RECORDS 8000
+
+/* Private types */
+typedef struct
+{
+    uint32_t ms;
+    uint16_t values[HISTORY_NUM_FIELDS];
+} Record_t;
+
+/* Private variables */
+uint32_t stub_tick;
+
+// Field order of the change mask, as documented in the guide
+static const uint32_t fields[HISTORY_NUM_FIELDS] = {40001, 40002, 40003, 40004, 40013, 40014,
+                                                    40015, 40009, 40010, 40011, 40012, 40401};
+static uint16_t current[HISTORY_NUM_FIELDS];
+static Record_t appended[MAX_RECORDS]; // Indexed by sequence number
+static uint32_t appended_count;
+static Record_t decoded[MAX_RECORDS];
+static uint32_t decoded_seq[MAX_RECORDS];
+
+/* Private functions */
+
+uint16_t Modbus_Device_Read(uint32_t logical_address)
+{
+    for (int i = 0; i < HISTORY_NUM_FIELDS; i++)
+    {
+        if (fields[i] == logical_address)
+            return current[i];
+    }
+    return 0;
+}
+
+static void reset(void)
+{
+    History_Init();
+    memset(current, 0, sizeof(current));
+    appended_count = 0;
+}
+
+static void append(uint32_t ms)
+{
+    stub_tick = ms;
+    History_Append();
+    appended[appended_count].ms = ms;
+    memcpy(appended[appended_count].values, current, sizeof(current));
+    appended_count++;
+}
+
+static uint32_t read_u32(uint16_t reg_hi)
+{
+    return ((uint32_t)History_ReadRegister(reg_hi) << 16) | History_ReadRegister(reg_hi + 1);
+}
+
+static void set_cursor(uint32_t cursor)
+{
+    History_WriteRegister(HISTORY_REG_CURSOR_HI, cursor >> 16);
+    History_WriteRegister(HISTORY_REG_CURSOR_LO, cursor & 0xFFFF);
+}
+
+// Encoded bytes of the block holding a record
+static uint16_t block_bytes(uint32_t seq)
+{
+    set_cursor(seq);
+    History_ReadRegister(HISTORY_REG_BLOCK_SEQ_HI);
+    return History_ReadRegister(HISTORY_REG_BLOCK_BYTES);
+}
+
+static uint32_t get_varint(const uint8_t *data, uint16_t *pos)
+{
+    uint32_t value = 0;
+    uint8_t shift = 0;
+    uint8_t byte;
+
+    do
+    {
+        byte = data[(*pos)++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+// Backfill from a cursor as a master would; returns records decoded, -1 on a format error
+static int decode_from(uint32_t cursor)
+{
+    int n = 0;
+
+    for (;;)
+    {
+        set_cursor(cursor);
+
+        // One FC03 of 40707-40776: header, then the block data
+        uint32_t first = read_u32(HISTORY_REG_BLOCK_SEQ_HI);
+        uint32_t ms = read_u32(HISTORY_REG_BLOCK_MS_HI);
+        uint16_t records = History_ReadRegister(HISTORY_REG_BLOCK_RECORDS);
+        uint16_t used = History_ReadRegister(HISTORY_REG_BLOCK_BYTES);
+        uint8_t data[HISTORY_BLOCK_BYTES];
+        for (int i = 0; i < HISTORY_BLOCK_BYTES / 2; i++)
+        {
+            uint16_t word = History_ReadRegister(HISTORY_REG_DATA + i);
+            data[2 * i] = word >> 8;
+            data[2 * i + 1] = word & 0xFF;
+        }
+
+        if (records == 0 || first + records <= cursor)
+            return n;
+
+        uint16_t prev[HISTORY_NUM_FIELDS] = {0};
+        uint16_t pos = 0;
+        for (uint16_t r = 0; r < records; r++)
+        {
+            ms += get_varint(data, &pos) * HISTORY_TIME_UNIT_MS;
+            uint32_t mask = get_varint(data, &pos);
+            for (int i = 0; i < HISTORY_NUM_FIELDS; i++)
+            {
+                if (mask & (1U << i))
+                {
+                    uint32_t zigzag = get_varint(data, &pos);
+                    prev[i] += (uint16_t)((zigzag >> 1) ^ (0U - (zigzag & 1)));
+                }
+            }
+            if (first + r >= cursor && n < MAX_RECORDS)
+            {
+                decoded[n].ms = ms;
+                memcpy(decoded[n].values, prev, sizeof(prev));
+                decoded_seq[n] = first + r;
+                n++;
+            }
+        }
+        if (pos != used)
+            return -1;
+        cursor = first + records;
+    }
+}
+
+// Decoded records equal the appended ones; times are truncated to the time unit
+static int decoded_match(int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        const Record_t *want = &appended[decoded_seq[i]];
+        if (memcmp(decoded[i].values, want->values, sizeof(want->values)) != 0)
+            return 0;
+        if (decoded[i].ms > want->ms || want->ms - decoded[i].ms >= HISTORY_TIME_UNIT_MS)
+            return 0;
+    }
+    return 1;
+}
+
+// Bytes one record adds to the open block
+static uint16_t record_bytes(uint32_t ms)
+{
+    uint16_t before = block_bytes(appended_count - 1);
+    append(ms);
+    return block_bytes(appended_count - 1) - before;
+}
+
+/* Tests */
+
+static void test_delta_boundaries(void)
+{
+    // Delta applied to field 0, and the varint bytes its zig-zag needs
+    static const struct
+    {
+        int32_t delta;
+        uint8_t bytes;
+    } steps[] = {
+        {1, 1},     {-1, 1},    {63, 1},     {-64, 1},     {64, 2},      {-65, 2},     {8191, 2},
+        {-8192, 2}, {8192, 3},  {-8193, 3},  {32767, 3},   {-32768, 3},  {0x8000, 3},  {0x7FFF, 3},
+    };
+    uint32_t ms = 1000;
+    int sizes_ok = 1;
+
+    reset();
+    current[0] = 30000;
+    append(ms);
+
+    for (unsigned s = 0; s < sizeof(steps) / sizeof(steps[0]); s++)
+    {
+        ms += 1000;
+        current[0] = (uint16_t)(current[0] + steps[s].delta);
+        // dt 10 and mask 0x001: one byte each
+        uint16_t bytes = record_bytes(ms);
+        if (bytes != 2 + steps[s].bytes)
+        {
+            printf("     delta %d: %u-byte record\n", (int)steps[s].delta, bytes);
+            sizes_ok = 0;
+        }
+    }
+    CHECK(sizes_ok, "field delta sizes step at 63/64, 8191/8192 and both signs");
+
+    // Wrap-around both ways
+    current[0] = 0xFFFF;
+    append(ms += 1000);
+    current[0] = 0x0000;
+    append(ms += 1000);
+    current[0] = 0x8000;
+    append(ms += 1000);
+
+    int n = decode_from(0);
+    CHECK(n == (int)appended_count && decoded_match(n), "delta boundaries and wrap-around round-trip");
+}
+
+static void test_time_and_mask_boundaries(void)
+{
+    uint32_t ms = 5000;
+
+    reset();
+    current[5] = 2350;
+    append(ms);
+
+    CHECK(record_bytes(ms += 99) == 2, "dt 0 (99 ms), no change: 2 bytes");
+    CHECK(record_bytes(ms += 12700 - 99) == 2, "dt 127: 1-byte varint");
+    CHECK(record_bytes(ms += 12800) == 3, "dt 128: 2-byte varint");
+    CHECK(record_bytes(ms += 1638300) == 3, "dt 16383: 2-byte varint");
+    CHECK(record_bytes(ms += 1638400) == 4, "dt 16384: 3-byte varint");
+
+    current[6] = 1; // Bit 6: mask 0x40
+    CHECK(record_bytes(ms += 1000) == 3, "mask 0x040: 1-byte varint");
+    current[7] = 1; // Bit 7: mask 0x80
+    CHECK(record_bytes(ms += 1000) == 4, "mask 0x080: 2-byte varint");
+    current[11] = 0x0201; // Bit 11: alarm summary
+    CHECK(record_bytes(ms += 1000) == 5, "mask 0x800, delta 0x201: 2 + 2 bytes");
+
+    for (int i = 0; i < HISTORY_NUM_FIELDS; i++)
+        current[i] = (uint16_t)(0x8000 + i * 0x1111);
+    append(ms += 1000);
+
+    int n = decode_from(0);
+    CHECK(n == (int)appended_count && decoded_match(n), "time and mask boundaries round-trip");
+}
+
+static void test_blocks_and_ring(void)
+{
+    uint32_t ms = 0;
+    int n;
+
+    reset();
+    srand(7);
+    for (int k = 0; k < 5000; k++)
+    {
+        // Large random steps force many blocks and several ring wraps
+        for (int i = 0; i < HISTORY_NUM_FIELDS; i++)
+        {
+            if (rand() % 3 == 0)
+                current[i] = (uint16_t)(current[i] + (rand() % 20001) - 10000);
+        }
+        append(ms += 1000 + rand() % 50);
+    }
+
+    uint32_t oldest = read_u32(HISTORY_REG_OLDEST_HI);
+    uint32_t next = read_u32(HISTORY_REG_NEXT_HI);
+    CHECK(next == appended_count && oldest > 0, "ring wrapped, oldest blocks dropped");
+
+    n = decode_from(oldest);
+    CHECK(n == (int)(next - oldest) && decoded_match(n), "every retained record round-trips");
+
+    n = decode_from(next - 10);
+    CHECK(n == 10 && decoded_seq[0] == next - 10 && decoded_match(n), "cursor inside a block skips earlier records");
+
+    n = decode_from(0);
+    CHECK(n > 0 && decoded_seq[0] == oldest && decoded_match(n), "overwritten cursor resumes at the oldest record");
+
+    CHECK(decode_from(next) == 0, "cursor at the next record returns nothing");
+}
+
+/* Benchmark */
+
+static double gauss(void)
+{
+    double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+// One hour of sensor updates: 0 = clean air, 1 = gas event, 2 = noisy ADC
+static void generate_trace(int scenario, Record_t *trace)
+{
+    static const uint16_t base[4] = {410, 520, 380, 600};
+    double co2 = 450, temp = 2350, rh = 4500;
+    uint32_t ms = 1000;
+
+    for (int k = 0; k < TRACE_RECORDS; k++)
+    {
+        uint16_t *v = trace[k].values;
+        double noise = (scenario == 2) ? 12 : 1.5;
+        double gas = 0;
+
+        ms += 1000 + (rand() % 3); // 1 Hz timer with jitter
+        trace[k].ms = ms;
+
+        if (scenario == 1 && k > 600 && k < 1800)
+        {
+            double x = (k - 600) / 30.0;
+            gas = (k < 900) ? 2000 * (1 - exp(-x)) : 2000 * exp(-(k - 900) / 200.0);
+        }
+        for (int c = 0; c < 4; c++)
+        {
+            double mv = base[c] + gas * (c == 1 ? 1 : 0.3) + noise * gauss();
+            v[c] = (uint16_t)mv;     // 40001-40004
+            v[7 + c] = mv > 1500;    // 40009-40012
+        }
+        if (k % 2 == 0) // SCD30 2 s interval
+        {
+            co2 += gauss() * 3 + ((scenario == 1 && k > 600 && k < 900) ? 5 : 0);
+            temp += gauss() * 2;
+            rh += gauss() * 4;
+        }
+        v[4] = (uint16_t)co2;
+        v[5] = (uint16_t)temp;
+        v[6] = (uint16_t)rh;
+        v[11] = (v[1] > 1500) ? 0x0101 : 0;
+        if (scenario == 1 && k > 1300)
+            v[11] = 0x0200;
+    }
+}
+
+static double elapsed_ns(const struct timespec *a, const struct timespec *b)
+{
+    return (b->tv_sec - a->tv_sec) * 1e9 + (b->tv_nsec - a->tv_nsec);
+}
+
+static void bench(void)
+{
+    static const char *names[] = {"clean air", "gas event", "noisy ADC (+-12 counts)"};
+    static Record_t trace[TRACE_RECORDS];
+    struct timespec a, b;
+    int all_match = 1;
+
+    srand(1);
+    for (int scenario = 0; scenario < 3; scenario++)
+    {
+        generate_trace(scenario, trace);
+        reset();
+
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        for (int k = 0; k < TRACE_RECORDS; k++)
+        {
+            memcpy(current, trace[k].values, sizeof(current));
+            append(trace[k].ms);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        double enc_ns = elapsed_ns(&a, &b) / TRACE_RECORDS;
+
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        int n = decode_from(0);
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        double dec_ns = elapsed_ns(&a, &b) / (n > 0 ? n : 1);
+        all_match &= n > 0 && decoded_match(n);
+
+        uint32_t bytes = 0;
+        uint32_t next = read_u32(HISTORY_REG_NEXT_HI);
+        for (uint32_t seq = read_u32(HISTORY_REG_OLDEST_HI); seq < next;)
+        {
+            bytes += block_bytes(seq);
+            seq = read_u32(HISTORY_REG_BLOCK_SEQ_HI) + History_ReadRegister(HISTORY_REG_BLOCK_RECORDS);
+        }
+        double per_record = (double)bytes / n;
+
+        printf("bench: %-24s %4d records (%4.1f min)  %5.2f B/record  %3.1fx vs %d B  enc %4.0f ns  dec %4.0f ns\n",
+               names[scenario], n, n / 60.0, per_record, 2.0 * HISTORY_NUM_FIELDS / per_record,
+               2 * HISTORY_NUM_FIELDS, enc_ns, dec_ns);
+    }
+    CHECK(all_match, "simulated traces round-trip");
+}
+
+int main(void)
+{
+    test_delta_boundaries();
+    test_time_and_mask_boundaries();
+    test_blocks_and_ring();
+    bench();
+
+    return TEST_RESULT();
+}
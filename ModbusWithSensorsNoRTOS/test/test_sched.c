@@ -0,0 +1,267 @@
+/**
+ * @file    test_sched.c
+ * @brief   Host test of the deadline scheduler on a virtual clock
+ *
+ * sched.c takes its time through Sched_Clock_t, so the test drives it with
+ * a millisecond counter and a 64 MHz cycle counter that it advances itself:
+ * by the cost of each task run, and by 1 ms whenever nothing is due. The
+ * task table mirrors tasks.c. Checked:
+ *
+ *   - a nominal run across the millisecond and cycle counter wrap: no early
+ *     or late starts, no overruns or skipped releases
+ *   - a 150 ms task shows up as start delay of the others
+ *   - a 5 s stall: missed releases are dropped, not run back to back, and
+ *     every task goes on at its original phase
+ *   - a task that exceeds its deadline counts overruns; the run time
+ *     registers are exact and saturate at 65535 us
+ *   - Sched_Request() and Sched_SetPeriod() leave the phase alone
+ */
+
+#include "sched.h"
+#include "test.h"
+#include <string.h>
+
+/* Private constants */
+#define NUM_TASKS 4
+#define MAX_STARTS 64
+#define CYCLES_PER_MS 64000U // 64 MHz
+
+/* Private types */
+typedef struct
+{
+    uint32_t cost_ms;    // Virtual time each run takes
+    uint32_t stall_run;  // Run number (1-based) that takes stall_ms extra, 0 = none
+    uint32_t stall_ms;
+    uint32_t starts[MAX_STARTS];
+    uint32_t n;
+} Job_t;
+
+/* Private variables */
+uint32_t stub_tick; // Claimed by the forced stub/main.h, unused here
+
+static uint32_t vt_ms;
+static uint32_t vt_cycles;
+static uint32_t vt_init; // Tick of Sched_Init
+static Job_t jobs[NUM_TASKS];
+static Sched_Task_t tasks[NUM_TASKS];
+
+/* Private functions */
+
+static uint32_t clock_ms(void)
+{
+    return vt_ms;
+}
+
+static uint32_t clock_cycles(void)
+{
+    return vt_cycles;
+}
+
+static const Sched_Clock_t vclock = {clock_ms, clock_cycles, CYCLES_PER_MS / 1000};
+
+static void advance(uint32_t ms)
+{
+    vt_ms += ms;
+    vt_cycles += ms * CYCLES_PER_MS;
+}
+
+static void job_run(int i)
+{
+    Job_t *j = &jobs[i];
+
+    if (j->n < MAX_STARTS)
+        j->starts[j->n] = vt_ms;
+    j->n++;
+    advance(j->cost_ms + (j->n == j->stall_run ? j->stall_ms : 0));
+}
+
+static void run_mq2(void)
+{
+    job_run(0);
+}
+
+static void run_scd30(void)
+{
+    job_run(1);
+}
+
+static void run_publish(void)
+{
+    job_run(2);
+}
+
+static void run_diag(void)
+{
+    job_run(3);
+}
+
+// Same periods, phases and deadlines as tasks.c; every run costs 1 ms
+static void setup(uint32_t start_ms, uint32_t start_cycles)
+{
+    static const Sched_Task_t table[NUM_TASKS] = {
+        {.run = run_mq2, .period_ms = 1000, .phase_ms = 0},
+        {.run = run_scd30, .period_ms = 2000, .phase_ms = 500},
+        {.run = run_publish, .period_ms = 1000, .phase_ms = 20, .deadline_ms = 200},
+        {.run = run_diag, .period_ms = 5000, .phase_ms = 60},
+    };
+
+    memcpy(tasks, table, sizeof(tasks));
+    memset(jobs, 0, sizeof(jobs));
+    for (int i = 0; i < NUM_TASKS; i++)
+        jobs[i].cost_ms = 1;
+    vt_ms = start_ms;
+    vt_cycles = start_cycles;
+    vt_init = start_ms;
+    Sched_Init(tasks, NUM_TASKS, &vclock);
+}
+
+// Main loop: run what is due, otherwise idle for a millisecond
+static void run_for(uint32_t ms)
+{
+    uint32_t end = vt_ms + ms;
+
+    while ((int32_t)(vt_ms - end) < 0)
+    {
+        if (!Sched_RunNext())
+            advance(1);
+    }
+}
+
+// Start delay of a run from the release grid of its task
+static uint32_t phase_offset(int i, uint32_t start)
+{
+    return (start - vt_init - tasks[i].phase_ms) % tasks[i].period_ms;
+}
+
+// Largest start delay of task i over the runs that started at or after from_ms
+static uint32_t max_offset(int i, uint32_t from_ms)
+{
+    uint32_t worst = 0;
+
+    for (uint32_t r = 0; r < jobs[i].n && r < MAX_STARTS; r++)
+    {
+        if ((int32_t)(jobs[i].starts[r] - (vt_init + from_ms)) < 0)
+            continue;
+        uint32_t off = phase_offset(i, jobs[i].starts[r]);
+        if (off > worst)
+            worst = off;
+    }
+    return worst;
+}
+
+/* Tests */
+
+static void test_nominal_wrap(void)
+{
+    // The tick wraps after 10 s, the cycle counter after 5 s
+    setup(0xFFFFFFFFU - 10000, 0xFFFFFFFFU - 5000 * CYCLES_PER_MS);
+    run_for(20000);
+
+    uint32_t late = 0, problems = 0;
+    for (int i = 0; i < NUM_TASKS; i++)
+    {
+        if (max_offset(i, 0) > late)
+            late = max_offset(i, 0);
+        problems += Sched_ReadRegister(i, SCHED_REG_OVERRUNS) + Sched_ReadRegister(i, SCHED_REG_SKIPPED);
+    }
+    CHECK(late == 0, "nominal: every run starts on its release");
+    CHECK(problems == 0, "nominal: no overruns or skipped releases");
+    CHECK(jobs[0].n == 20 && jobs[1].n == 10 && jobs[2].n == 20 && jobs[3].n == 4, "nominal: run counts");
+    CHECK(Sched_ReadRegister(0, SCHED_REG_RUNS) == 20, "runs register");
+    CHECK(Sched_ReadRegister(2, SCHED_REG_LAST_US) == 1000, "run time measured across the cycle wrap");
+}
+
+static void test_long_task(void)
+{
+    setup(0, 0);
+    jobs[0].cost_ms = 150;
+    run_for(10000);
+
+    CHECK(Sched_ReadRegister(2, SCHED_REG_MAX_LATE_MS) == 130, "150 ms task delays the 20 ms phase task by 130 ms");
+    CHECK(Sched_ReadRegister(3, SCHED_REG_MAX_LATE_MS) == 91, "and the 60 ms phase task by 91 ms");
+    CHECK(Sched_ReadRegister(2, SCHED_REG_OVERRUNS) == 0, "delay within the 200 ms deadline is no overrun");
+    CHECK(Sched_ReadRegister(0, SCHED_REG_WCET_US) == 65535, "150 ms run saturates the WCET register");
+}
+
+static void test_stall(void)
+{
+    setup(0, 0);
+    jobs[0].stall_run = 3; // The run released at 2 s takes 5 s
+    jobs[0].stall_ms = 5000;
+    run_for(20000);
+
+    // Each task serves its oldest overdue release once, then only releases
+    // whose deadline is still ahead: a catch-up would overrun again
+    uint32_t after = 0, once = 1, skipped = 1;
+    for (int i = 0; i < NUM_TASKS; i++)
+    {
+        if (max_offset(i, 8000) > after)
+            after = max_offset(i, 8000);
+        once &= Sched_ReadRegister(i, SCHED_REG_OVERRUNS) <= 1;
+        skipped &= Sched_ReadRegister(i, SCHED_REG_SKIPPED) > 0 || i == 3; // 5 s deadline not missed
+    }
+    CHECK(Sched_ReadRegister(0, SCHED_REG_OVERRUNS) == 1, "stall: the stalled run is an overrun");
+    CHECK(Sched_ReadRegister(0, SCHED_REG_SKIPPED) == 4, "stall: releases 3-6 s dropped");
+    CHECK(jobs[0].starts[3] == 7003 && jobs[0].starts[4] == 8000, "stall: next run is the 7 s release");
+    CHECK(skipped, "stall: every task whose deadline passed skipped releases");
+    CHECK(once, "stall: missed releases are not run back to back");
+    CHECK(after <= 2, "stall: every task back on its phase");
+    CHECK(jobs[0].n == 16, "stall: 20 s minus the dropped releases");
+}
+
+static void test_overrun(void)
+{
+    setup(0, 0);
+    jobs[2].cost_ms = 300; // 200 ms deadline
+    jobs[3].cost_ms = 2;
+    run_for(10000);
+
+    uint16_t runs = Sched_ReadRegister(2, SCHED_REG_RUNS);
+    CHECK(runs == 10 && Sched_ReadRegister(2, SCHED_REG_OVERRUNS) == runs, "overrun: every 300 ms run counted");
+    CHECK(Sched_ReadRegister(2, SCHED_REG_SKIPPED) == 0, "overrun: next release still reachable, none skipped");
+    CHECK(Sched_ReadRegister(2, SCHED_REG_LAST_US) == 65535, "overrun: run time saturates");
+    CHECK(Sched_ReadRegister(3, SCHED_REG_WCET_US) == 2000, "2 ms task: WCET 2000 us");
+}
+
+static void test_request(void)
+{
+    setup(0, 0);
+    run_for(300);
+    Sched_Request(0);
+    CHECK(Sched_RunNext() && jobs[0].n == 2 && jobs[0].starts[1] == 300, "request: extra run at once");
+    CHECK(Sched_ReadRegister(0, SCHED_REG_RUNS) == 2, "request: run counted");
+
+    run_for(2600);
+    CHECK(jobs[0].n == 4 && jobs[0].starts[2] == 1000 && jobs[0].starts[3] == 2000, "request: phase kept");
+    CHECK(Sched_ReadRegister(0, SCHED_REG_SKIPPED) == 0, "request: no release skipped");
+
+    // A request that meets a due release runs once
+    run_for(3000 - vt_ms);
+    Sched_Request(0);
+    run_for(10);
+    CHECK(jobs[0].n == 5 && jobs[0].starts[4] == 3000, "request: merged with a due release");
+}
+
+static void test_set_period(void)
+{
+    setup(0, 0);
+    run_for(100);
+    Sched_SetPeriod(1, 5000);
+    run_for(12000);
+
+    CHECK(jobs[1].n == 3 && jobs[1].starts[0] == 500 && jobs[1].starts[1] == 5500 && jobs[1].starts[2] == 10500,
+          "set period: applies from the next release");
+    CHECK(Sched_ReadRegister(1, SCHED_REG_PERIOD_MS) == 5000, "set period: register");
+}
+
+int main(void)
+{
+    test_nominal_wrap();
+    test_long_task();
+    test_stall();
+    test_overrun();
+    test_request();
+    test_set_period();
+
+    return TEST_RESULT();
+}
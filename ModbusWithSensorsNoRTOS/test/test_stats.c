@@ -0,0 +1,246 @@
+/**
+ * @file    test_stats.c
+ * @brief   Host check of the windowed statistics against a brute-force reference
+ *
+ * Simulated sensors are sampled through Stats_Update() once per second for
+ * 100 hours: MQ2 mV with random dropouts, CO2 and humidity written as 0 while
+ * the SCD30 has failed, and a temperature that wanders across 0 °C, with
+ * 0xFFFF written on failure as the device does. Every snapshot published for
+ * the three default windows is compared with min/max/mean/stddev computed
+ * directly from the good samples of the buckets it covers. Min and max must
+ * match exactly, mean and stddev within rounding (0.51), and the sample
+ * count must be that of the channel with the most good readings.
+ */
+
+#include "health.h"
+#include "modbus_device.h"
+#include "stats.h"
+#include "test.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private constants */
+#define SECONDS 360000U // 100 hours at 1 Hz
+#define INIT_SECONDS 5  // Bring-up: every channel initialising, registers 0
+#define TEMP_CHANNEL 5
+
+/* Private types */
+typedef struct
+{
+    uint16_t raw[STATS_NUM_CHANNELS];
+    uint8_t good[STATS_NUM_CHANNELS];
+} Sample_t;
+
+/* Private variables */
+uint32_t stub_tick;
+
+// Same order as the statistics channels
+static const uint32_t sources[STATS_NUM_CHANNELS] = {40005, 40006, 40007, 40008, 40013, 40014, 40015};
+static Sample_t *samples;
+static Sample_t current;
+
+/* Private functions */
+
+uint16_t Modbus_Device_Read(uint32_t logical_address)
+{
+    for (int c = 0; c < STATS_NUM_CHANNELS; c++)
+    {
+        if (sources[c] == logical_address)
+            return current.raw[c];
+    }
+    return 0;
+}
+
+uint16_t Health_ReadValueQuality(uint8_t index)
+{
+    for (int c = 0; c < STATS_NUM_CHANNELS; c++)
+    {
+        if (sources[c] - 40001 == index)
+            return current.good[c] ? HEALTH_QUALITY_GOOD : HEALTH_QUALITY_COMM_FAIL;
+    }
+    return HEALTH_QUALITY_NO_DATA;
+}
+
+static int32_t walk(int32_t x, int32_t step, int32_t lo, int32_t hi)
+{
+    x += rand() % (2 * step + 1) - step;
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+
+// Next second of simulated sensors, in register form
+static void simulate(uint32_t s)
+{
+    static int32_t mv[4] = {400, 900, 1500, 2600};
+    static int32_t co2 = 800, temp = 300, rh = 4500;
+    static uint8_t scd30_bad;
+
+    for (int c = 0; c < 4; c++)
+    {
+        mv[c] = walk(mv[c], 40, 0, 3300);
+        current.good[c] = rand() % 100 >= 3;
+        current.raw[c] = current.good[c] ? (uint16_t)mv[c] : 0;
+    }
+
+    // The SCD30 fails for stretches of a few seconds to a minute
+    if (scd30_bad)
+        scd30_bad = rand() % 20 != 0;
+    else
+        scd30_bad = rand() % 200 == 0;
+
+    co2 = walk(co2, 15, 400, 2500);
+    temp = walk(temp, 12, -1500, 2500);
+    rh = walk(rh, 20, 1000, 9000);
+    for (int c = 4; c < STATS_NUM_CHANNELS; c++)
+        current.good[c] = !scd30_bad;
+    current.raw[4] = scd30_bad ? 0 : (uint16_t)co2;
+    current.raw[5] = scd30_bad ? 0xFFFF : (uint16_t)(int16_t)temp;
+    current.raw[6] = scd30_bad ? 0 : (uint16_t)rh;
+
+    if (s < INIT_SECONDS)
+        memset(&current, 0, sizeof(current));
+}
+
+static int32_t as_value(int c, uint16_t raw)
+{
+    return c == TEMP_CHANNEL ? (int16_t)raw : raw;
+}
+
+/* Tests */
+
+static void test_reference(void)
+{
+    static const uint16_t windows_s[STATS_NUM_WINDOWS] = STATS_DEFAULT_WINDOWS_S;
+    uint32_t closed[STATS_NUM_WINDOWS] = {0};
+    uint16_t updates[STATS_NUM_WINDOWS];
+    uint32_t snapshots = 0, empty = 0, below_zero = 0;
+    uint32_t minmax_bad = 0, mean_bad = 0, stddev_bad = 0, count_bad = 0, updates_bad = 0;
+    double worst_mean = 0, worst_stddev = 0;
+
+    samples = calloc(SECONDS, sizeof(*samples));
+    srand(1);
+    stub_tick = 0;
+    Stats_Init();
+    for (int w = 0; w < STATS_NUM_WINDOWS; w++)
+        updates[w] = Stats_ReadSnapshot(w, STATS_REG_UPDATES);
+
+    for (uint32_t s = 0; s < SECONDS; s++)
+    {
+        simulate(s);
+        samples[s] = current;
+        stub_tick = (s + 1) * 1000;
+        Stats_Update();
+
+        for (int w = 0; w < STATS_NUM_WINDOWS; w++)
+        {
+            uint32_t bucket_ms = windows_s[w] * 1000U / STATS_BUCKETS;
+            uint32_t now_closed = stub_tick / bucket_ms;
+
+            if (now_closed == closed[w])
+                continue;
+
+            // Buckets that closed since the last check, each one a snapshot
+            uint16_t u = Stats_ReadSnapshot(w, STATS_REG_UPDATES);
+            updates_bad += (uint16_t)(u - updates[w]) != now_closed - closed[w];
+            updates[w] = u;
+            closed[w] = now_closed;
+            snapshots++;
+
+            // Sample s was taken at (s + 1) s, in bucket (s + 1) * 1000 / bucket_ms
+            uint32_t first = now_closed > STATS_BUCKETS ? (now_closed - STATS_BUCKETS) * bucket_ms / 1000 - 1 : 0;
+            uint32_t end = now_closed * bucket_ms / 1000 - 1;
+            uint16_t most = 0;
+
+            for (int c = 0; c < STATS_NUM_CHANNELS; c++)
+            {
+                int32_t lo = 0, hi = 0;
+                double sum = 0, sum2 = 0;
+                uint16_t n = 0;
+
+                for (uint32_t i = first; i < end; i++)
+                {
+                    if (!samples[i].good[c])
+                        continue;
+                    int32_t x = as_value(c, samples[i].raw[c]);
+                    if (n == 0 || x < lo)
+                        lo = x;
+                    if (n == 0 || x > hi)
+                        hi = x;
+                    sum += x;
+                    n++;
+                }
+                double mean = n ? sum / n : 0;
+                for (uint32_t i = first; i < end; i++)
+                {
+                    double d = as_value(c, samples[i].raw[c]) - mean;
+                    if (samples[i].good[c])
+                        sum2 += d * d;
+                }
+                double stddev = n ? sqrt(sum2 / n) : 0;
+                if (n > most)
+                    most = n;
+                if (n == 0)
+                    empty++;
+                if (c == TEMP_CHANNEL && n > 0 && lo < 0)
+                    below_zero++;
+
+                uint16_t base = STATS_REG_CHANNELS + c * STATS_FIELD_COUNT;
+                int32_t got_mean = as_value(c, Stats_ReadSnapshot(w, base + STATS_FIELD_MEAN));
+                uint16_t got_stddev = Stats_ReadSnapshot(w, base + STATS_FIELD_STDDEV);
+                int32_t got_min = as_value(c, Stats_ReadSnapshot(w, base + STATS_FIELD_MIN));
+                int32_t got_max = as_value(c, Stats_ReadSnapshot(w, base + STATS_FIELD_MAX));
+
+                minmax_bad += got_min != lo || got_max != hi;
+                if (fabs(got_mean - mean) > worst_mean)
+                    worst_mean = fabs(got_mean - mean);
+                if (fabs(got_stddev - stddev) > worst_stddev)
+                    worst_stddev = fabs(got_stddev - stddev);
+                mean_bad += fabs(got_mean - mean) > 0.51;
+                stddev_bad += fabs(got_stddev - stddev) > 0.51;
+            }
+            count_bad += Stats_ReadSnapshot(w, STATS_REG_SAMPLES) != most;
+        }
+    }
+
+    printf("%u snapshots, %u empty channels, %u with sub-zero temperature; "
+           "worst mean error %.3f, stddev %.3f\n",
+           snapshots, empty, below_zero, worst_mean, worst_stddev);
+    CHECK(snapshots > 200000 && empty > 0 && below_zero > 0, "reference run covers failures and sub-zero values");
+    CHECK(updates_bad == 0, "snapshot counter steps once per closed bucket");
+    CHECK(minmax_bad == 0, "min/max equal the reference");
+    CHECK(mean_bad == 0, "mean within rounding of the reference");
+    CHECK(stddev_bad == 0, "stddev within rounding of the reference");
+    CHECK(count_bad == 0, "sample count is the channel with the most good readings");
+    free(samples);
+}
+
+static void test_sub_zero(void)
+{
+    uint16_t base = STATS_REG_CHANNELS + TEMP_CHANNEL * STATS_FIELD_COUNT;
+
+    stub_tick = 0;
+    Stats_Init();
+    memset(&current, 0, sizeof(current));
+    // Ticks 0-9 s fill buckets 0-4 of the 10 s window; the update at 10 s publishes them
+    for (uint32_t s = 0; s <= 10; s++)
+    {
+        current.good[TEMP_CHANNEL] = 1;
+        current.raw[TEMP_CHANNEL] = (uint16_t)(int16_t)(s & 1 ? -510 : -490);
+        stub_tick = s * 1000;
+        Stats_Update();
+    }
+
+    CHECK((int16_t)Stats_ReadSnapshot(0, base + STATS_FIELD_MEAN) == -500, "-5.00 C mean stays negative");
+    CHECK((int16_t)Stats_ReadSnapshot(0, base + STATS_FIELD_MIN) == -510, "-5.10 C minimum");
+    CHECK((int16_t)Stats_ReadSnapshot(0, base + STATS_FIELD_MAX) == -490, "-4.90 C maximum");
+    CHECK(Stats_ReadSnapshot(0, base + STATS_FIELD_STDDEV) == 10, "stddev 0.10 C");
+    CHECK(Stats_ReadSnapshot(0, STATS_REG_CHANNELS + STATS_FIELD_MAX) == 0, "channel without good readings stays 0");
+}
+
+int main(void)
+{
+    test_sub_zero();
+    test_reference();
+
+    return TEST_RESULT();
+}
@@ -1,53 +0,0 @@
-/**
- * stModbus Libary: A tiny Modbus implementation for Modbus ASCII/RTU
- * Copyright (c) 2021+ [Iurii Bell] ds@inbox.ru (http://www.bel-tech.ru/)
- * All rights reserved.
- *
- * [MIT License](http://www.opensource.org/licenses/mit-license.php)
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in
- * all copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
- * THE SOFTWARE.
- *
- * @copyright   Copyright (C) 2021+
- * @author      Iurii Bell (ds@inbox.ru)
- * @license     MIT
- * @package     stModbus
- */
-
-#ifndef _STMODBUS_MBDEVICE_H_
-#define _STMODBUS_MBDEVICE_H_
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || \
-    defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || \
-    defined(STM32F401xC) || defined(STM32F401xE) || defined(STM32F411xE) || defined(STM32F469xx) || \
-    defined(STM32F479xx) || defined(STM32F4) ||                                                     \
-    defined(STM32F303xx) || defined(STM32F302xx) || defined(STM32F301xx) || defined(STM32F3)
-#include <stm32f3xx_hal.h>
-  void modbus_usart_it(UART_HandleTypeDef *huart);
-#endif
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif // _STMODBUS_MBDEVICE_H_
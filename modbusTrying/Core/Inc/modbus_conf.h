@@ -44,7 +44,8 @@ extern "C"
 // <q>  Use Modbus-ASCII
 #define STMODBUS_USE_ASCII 0
 // <q>  Use critical sections (recommended)
-#define STMODBUS_USE_CRITICAL_SECTIONS 0
+// <i> mbus_flush() from the main loop races the parser in the UART interrupt
+#define STMODBUS_USE_CRITICAL_SECTIONS 1
 // <o> Count modbus context
 // <i> Don't set a lot of count for memory saving
 #define STMODBUS_COUNT_CONTEXT 1
@@ -47,11 +47,8 @@ void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
         // Validate context before processing
         if (modbus_ctx >= 0)
         {
-            // Process received Modbus data byte by byte
-            for (uint16_t i = 0; i < Size && i < sizeof(modbus_rx_buffer); i++)
-            {
-                mbus_poll(modbus_ctx, modbus_rx_buffer[i]);
-            }
+            // An idle line ends the frame; parse it with a fresh parser
+            mbus_poll_frame(modbus_ctx, modbus_rx_buffer, Size);
         } // Clear the UART idle flag
         __HAL_UART_CLEAR_IDLEFLAG(huart);
 
@@ -72,6 +69,10 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
         // Mark error for recovery system
         ModbusRecovery_MarkError();
 
+        // Lost characters count towards FC08 sub-function 0x12
+        if (huart->ErrorCode & HAL_UART_ERROR_ORE)
+            mbus_char_overrun(Modbus_GetContext());
+
         // Handle UART errors
         __HAL_UART_CLEAR_OREFLAG(huart);
         __HAL_UART_CLEAR_NEFLAG(huart);
@@ -6,8 +6,6 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Core/Src/main.c \
-../Core/Src/mbutils.c \
-../Core/Src/modbus.c \
 ../Core/Src/modbus_device.c \
 ../Core/Src/modbus_init.c \
 ../Core/Src/modbus_test.c \
@@ -20,8 +18,6 @@ C_SRCS += \
 
 OBJS += \
 ./Core/Src/main.o \
-./Core/Src/mbutils.o \
-./Core/Src/modbus.o \
 ./Core/Src/modbus_device.o \
 ./Core/Src/modbus_init.o \
 ./Core/Src/modbus_test.o \
@@ -34,8 +30,6 @@ OBJS += \
 
 C_DEPS += \
 ./Core/Src/main.d \
-./Core/Src/mbutils.d \
-./Core/Src/modbus.d \
 ./Core/Src/modbus_device.d \
 ./Core/Src/modbus_init.d \
 ./Core/Src/modbus_test.d \
@@ -49,12 +43,12 @@ C_DEPS += \
 
 # Each subdirectory must supply rules for building sources it contributes
 Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
-	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F303x8 -c -I../Core/Inc -I../../stModbus/Inc -I../Drivers/STM32F3xx_HAL_Driver/Inc/Legacy -I../Drivers/STM32F3xx_HAL_Driver/Inc -I../Drivers/CMSIS/Device/ST/STM32F3xx/Include -I../Drivers/CMSIS/Include -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/mbutils.cyclo ./Core/Src/mbutils.d ./Core/Src/mbutils.o ./Core/Src/mbutils.su ./Core/Src/modbus.cyclo ./Core/Src/modbus.d ./Core/Src/modbus.o ./Core/Src/modbus.su ./Core/Src/modbus_device.cyclo ./Core/Src/modbus_device.d ./Core/Src/modbus_device.o ./Core/Src/modbus_device.su ./Core/Src/modbus_init.cyclo ./Core/Src/modbus_init.d ./Core/Src/modbus_init.o ./Core/Src/modbus_init.su ./Core/Src/modbus_test.cyclo ./Core/Src/modbus_test.d ./Core/Src/modbus_test.o ./Core/Src/modbus_test.su ./Core/Src/stm32f3xx_hal_msp.cyclo ./Core/Src/stm32f3xx_hal_msp.d ./Core/Src/stm32f3xx_hal_msp.o ./Core/Src/stm32f3xx_hal_msp.su ./Core/Src/stm32f3xx_it.cyclo ./Core/Src/stm32f3xx_it.d ./Core/Src/stm32f3xx_it.o ./Core/Src/stm32f3xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f3xx.cyclo ./Core/Src/system_stm32f3xx.d ./Core/Src/system_stm32f3xx.o ./Core/Src/system_stm32f3xx.su ./Core/Src/uart_callbacks.cyclo ./Core/Src/uart_callbacks.d ./Core/Src/uart_callbacks.o ./Core/Src/uart_callbacks.su
+	-$(RM) ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/modbus_device.cyclo ./Core/Src/modbus_device.d ./Core/Src/modbus_device.o ./Core/Src/modbus_device.su ./Core/Src/modbus_init.cyclo ./Core/Src/modbus_init.d ./Core/Src/modbus_init.o ./Core/Src/modbus_init.su ./Core/Src/modbus_test.cyclo ./Core/Src/modbus_test.d ./Core/Src/modbus_test.o ./Core/Src/modbus_test.su ./Core/Src/stm32f3xx_hal_msp.cyclo ./Core/Src/stm32f3xx_hal_msp.d ./Core/Src/stm32f3xx_hal_msp.o ./Core/Src/stm32f3xx_hal_msp.su ./Core/Src/stm32f3xx_it.cyclo ./Core/Src/stm32f3xx_it.d ./Core/Src/stm32f3xx_it.o ./Core/Src/stm32f3xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f3xx.cyclo ./Core/Src/system_stm32f3xx.d ./Core/Src/system_stm32f3xx.o ./Core/Src/system_stm32f3xx.su ./Core/Src/uart_callbacks.cyclo ./Core/Src/uart_callbacks.d ./Core/Src/uart_callbacks.o ./Core/Src/uart_callbacks.su
 
 .PHONY: clean-Core-2f-Src
 
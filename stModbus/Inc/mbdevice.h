@@ -50,4 +50,4 @@ extern "C"
 }
 #endif
 
-#endif // _STMODBUS_MBDEVICE_H_
\ No newline at end of file
+#endif // _STMODBUS_MBDEVICE_H_
@@ -0,0 +1,73 @@
+/**
+ * @file    mbport.h
+ * @brief   stModbus port layer: what the engine needs from the OS / board
+ *
+ * The Modbus engine (modbus.c) is shared by every build. Everything that
+ * depends on how the firmware runs lives behind this interface, and a build
+ * links exactly one implementation from stModbus/port/:
+ *
+ *   baremetal/  main loop + interrupts (PRIMASK, HAL tick)
+ *   freertos/   FreeRTOS tasks (kernel critical sections, message buffer,
+ *               task notification on end of transmission)
+ *   host/       PC builds for tests and benchmarks (monotonic clock,
+ *               single thread)
+ *
+ * Every port provides the critical sections and the tick. Builds that
+ * parse frames outside the receive interrupt also need the rest:
+ *
+ * Frame queue: the receive interrupt hands one idle-line delimited frame at
+ * a time to whoever parses it (a task or a test driver).
+ * Transmit: the application's send callback starts the hardware, the port
+ * lets the caller wait for the last byte to leave without holding any lock.
+ *
+ * The bare-metal builds parse each frame in the receive interrupt and
+ * answer from there, so baremetal/ implements neither.
+ */
+
+#ifndef _STMODBUS_PORT_H_
+#define _STMODBUS_PORT_H_
+
+#include "modbus_conf.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Largest RTU frame (address + PDU + CRC) */
+#ifndef STMODBUS_MAX_FRAME_SIZE
+#define STMODBUS_MAX_FRAME_SIZE 256
+#endif
+
+/* Frame queue storage in bytes; the FreeRTOS port keeps a 4-byte length
+ * header per frame, so two full frames need 2 * (256 + 4) */
+#ifndef STMODBUS_QUEUE_SIZE
+#define STMODBUS_QUEUE_SIZE (2 * (STMODBUS_MAX_FRAME_SIZE + 4))
+#endif
+
+#define MBPORT_WAIT_FOREVER 0xFFFFFFFFU
+
+    /* Critical sections (task / main loop context; nest freely) */
+    void mbport_enter_critical(void);
+    void mbport_exit_critical(void);
+
+    /* Millisecond tick for the inter-character timeout */
+    uint32_t mbport_tickcount(void);
+
+    /* Frame queue, receive interrupt -> parser (freertos, host) */
+    void mbport_queue_init(void);
+    uint8_t mbport_queue_put_from_isr(const uint8_t *frame, uint16_t size);
+    uint16_t mbport_queue_get(uint8_t *frame, uint16_t size, uint32_t timeout_ms);
+
+    /* Transmit: begin before starting the hardware, done from its interrupt
+     * (freertos, host) */
+    void mbport_transmit_begin(void);
+    void mbport_transmit_done_from_isr(void);
+    uint8_t mbport_transmit_wait(uint32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STMODBUS_PORT_H_
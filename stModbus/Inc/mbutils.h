@@ -45,4 +45,4 @@ extern "C"
 }
 #endif
 
-#endif // _STMODBUS_UTILS_H_
\ No newline at end of file
+#endif // _STMODBUS_UTILS_H_
@@ -33,6 +33,7 @@
 #define _STMODBUS_DEFINE_H_
 
 #include "mbdevice.h"
+#include "mbport.h"
 #include "modbus_conf.h"
 #include <stdint.h>
 
@@ -42,26 +43,54 @@ extern "C"
 #endif
 
 #if (STMODBUS_USE_CRITICAL_SECTIONS == 0)
-#define stmbEnterCriticalSection
-#define stmbLeaveCriticalSection
+#define stmbEnterCriticalSection()
+#define stmbLeaveCriticalSection()
 #else
 
+// The port layer provides them unless modbus_conf.h overrides
 #ifndef stmbEnterCriticalSection
-#error \
-    "If you use RTOS/FreeRTOS plese define mutex '#define stmbEnterCriticalSection mutex.lock' or empty"
+#define stmbEnterCriticalSection mbport_enter_critical
 #endif
 
 #ifndef stmbLeaveCriticalSection
-#error \
-    "If you use RTOS/FreeRTOS plese define mutex '#define stmbLeaveCriticalSection mutex.unlock' or empty"
+#define stmbLeaveCriticalSection mbport_exit_critical
 #endif
 
 #endif
 
+#ifndef STMODBUS_COUNT_FUNC
+#define STMODBUS_COUNT_FUNC 0
+#endif
+
+// Entries of the communication event log (FC12); the protocol returns at most 64
+#ifndef STMODBUS_EVENT_LOG_SIZE
+#define STMODBUS_EVENT_LOG_SIZE 64
+#endif
+
+// Event hook for a trace recorder; modbus_conf.h may define it
+#ifndef STMODBUS_TRACE_CRC_FAIL
+#define STMODBUS_TRACE_CRC_FAIL(func)
+#endif
+
+// Profiling hook: a frame with function code func reached a point of the
+// path below; modbus_conf.h may define it, e.g. to stamp a cycle counter
+#define MBUS_PROF_FRAME 0  // mbus_poll_frame() entered
+#define MBUS_PROF_PARSED 1 // Frame complete with a good CRC, before mbus_poll_response()
+#define MBUS_PROF_BUILT 2  // Reply (or exception) built, mbus_send_data() entered
+#define MBUS_PROF_CRC 3    // Reply CRC appended, before the send callback
+#define MBUS_PROF_POINTS 4
+#ifndef STMODBUS_PROF_MARK
+#define STMODBUS_PROF_MARK(point, func)
+#endif
+
 #if (STMODBUS_COUNT_CONTEXT < 1)
 #error "Count modbus context must be more then 0"
 #endif
 
+#if (STMODBUS_EVENT_LOG_SIZE < 1) || (STMODBUS_EVENT_LOG_SIZE > 64)
+#error "Event log must hold 1 to 64 entries"
+#endif
+
 /*  Typedef definition */
 #include <stdint.h>
 
@@ -160,8 +189,42 @@ extern "C"
         was attempting to perform the requested action.
         */
         MBUS_RESPONSE_SERVICE_DEVICE_FAILURE = 0x04,
+        /*
+        The server is engaged in processing a long-duration command. The client
+        should retransmit the message later when the server is free.
+        */
+        MBUS_RESPONSE_SLAVE_DEVICE_BUSY = 0x06,
     } Modbus_ResponseType;
 
+    /* FC08 sub-functions */
+    typedef enum
+    {
+        MBUS_DIAG_RETURN_QUERY_DATA = 0x00,
+        MBUS_DIAG_RESTART_COMM = 0x01,
+        MBUS_DIAG_RETURN_REGISTER = 0x02,
+        MBUS_DIAG_CLEAR_COUNTERS = 0x0A,
+        MBUS_DIAG_BUS_MESSAGE_COUNT = 0x0B,
+        MBUS_DIAG_BUS_COMM_ERROR_COUNT = 0x0C,
+        MBUS_DIAG_EXCEPTION_COUNT = 0x0D,
+        MBUS_DIAG_SLAVE_MESSAGE_COUNT = 0x0E,
+        MBUS_DIAG_NO_RESPONSE_COUNT = 0x0F,
+        MBUS_DIAG_NAK_COUNT = 0x10,
+        MBUS_DIAG_BUSY_COUNT = 0x11,
+        MBUS_DIAG_CHAR_OVERRUN_COUNT = 0x12,
+        MBUS_DIAG_CLEAR_OVERRUN = 0x14,
+    } Modbus_DiagSubFunc;
+
+/* Communication event log entries (FC12) */
+#define MBUS_EVENT_RECEIVE 0x80          // Request received; or-ed with the bits below
+#define MBUS_EVENT_RX_COMM_ERROR 0x02    // CRC error
+#define MBUS_EVENT_RX_CHAR_OVERRUN 0x10  // Characters lost since the last receive event
+#define MBUS_EVENT_SEND 0x40             // Reply sent; or-ed with the bits below
+#define MBUS_EVENT_TX_READ_EXCEPTION 0x01  // Exception 1-3
+#define MBUS_EVENT_TX_ABORT_EXCEPTION 0x02 // Exception 4
+#define MBUS_EVENT_TX_BUSY_EXCEPTION 0x04  // Exception 5-6
+#define MBUS_EVENT_TX_NAK_EXCEPTION 0x08   // Exception 7
+#define MBUS_EVENT_COMM_RESTART 0x00     // FC08 sub-function 01
+
     /* Simple function for many usage
      *
      */
@@ -175,6 +238,8 @@ extern "C"
     typedef uint16_t (*stmbReadFunc)(const uint32_t logicAddress);
     typedef uint16_t (*stmbWriteFunc)(const uint32_t logicAddress, uint16_t value);
 
+    typedef uint16_t (*stmbReadFileFunc)(const uint16_t file, const uint16_t record);
+
     typedef int (*stmbSendFunc)(const mbus_t func, const uint8_t *data,
                                 const uint16_t size);
 
@@ -211,13 +276,32 @@ extern "C"
         stmbSendFunc send;
         stmbReadFunc read;
         stmbWriteFunc write;
+        stmbReadFileFunc read_file; // FC20, one register per call (0 = unsupported)
         uint8_t *sendbuf;
         uint16_t sendbuf_sz;
-        uint8_t *recvbuf;
+        uint8_t *recvbuf; // Request data; may alias the frame passed to mbus_poll_frame()
         uint16_t recvbuf_sz;
 
     } Modbus_Conf_t;
 
+    /* Serial line diagnostics (FC08) and communication events (FC11 / FC12);
+     * each counter is a single increment on the receive path and wraps */
+    typedef struct __stmodbus_diag_t
+    {
+        uint16_t bus_messages;   // Frames with a good CRC, any address
+        uint16_t comm_errors;    // Frames with a bad CRC
+        uint16_t exceptions;     // Exception replies sent
+        uint16_t slave_messages; // Frames for this device
+        uint16_t no_responses;   // Frames for this device that got no reply
+        uint16_t busy;           // Busy exception replies sent
+        uint16_t overruns;       // Character overruns (UART or receive buffer)
+        uint16_t event_count;    // Requests completed without an exception (FC11)
+        uint8_t overrun_flag;    // Overrun since the last receive event
+        uint8_t log_head;        // Next entry to write in log[]
+        uint8_t log_count;       // Entries in log[]
+        uint8_t log[STMODBUS_EVENT_LOG_SIZE];
+    } _stmodbus_diag_t;
+
     typedef struct __stmodbus_context_t
     {
         Modbus_Conf_t conf;
@@ -230,6 +314,7 @@ extern "C"
 #endif
         _stmodbus_request_header header;
         _stmodbus_request_header response;
+        _stmodbus_diag_t diag;
     } _stmodbus_context_t;
 
     typedef _stmodbus_context_t *mbus_context_t;
@@ -268,25 +353,42 @@ extern "C"
 
     mbus_status_t mbus_response(mbus_t mb_context, Modbus_ResponseType response);
 
+    /*
+     * function mbus_flush()
+     * drop a partial frame; safe against a parser running in an interrupt
+     * when STMODBUS_USE_CRITICAL_SECTIONS is set
+     */
     mbus_status_t mbus_flush(const mbus_t context);
 
+    /*
+     * function mbus_char_overrun()
+     * count characters lost by the UART (receive overrun interrupt) for FC08
+     * sub-function 0x12 and the next receive event of the FC12 log
+     */
+    void mbus_char_overrun(const mbus_t context);
+
     uint16_t mbus_hal_crc16(mbus_t mb_context, uint8_t byte);
 
     uint16_t mbus_crc16(const uint16_t crc16, const uint8_t byte);
 
     uint16_t mbus_error(Modbus_ResponseType error);
 
-    uint32_t mbus_tickcount();
-
     int mbus_proto_address(Modbus_ConnectFuncType func, int *r);
 
     /*
-     * function mbus_close()
-     * close modbus context
-     * return: none
+     * function mbus_poll()
+     * feed one received byte to the parser, answer a complete frame
+     * return: MBUS_ERROR on a bad frame or a failed reply
      */
     mbus_status_t mbus_poll(mbus_t mb_context, uint8_t byte);
 
+    /*
+     * function mbus_poll_frame()
+     * parse one complete frame (a silent line ended it) with a fresh parser
+     * return: MBUS_ERROR if the last byte was rejected
+     */
+    mbus_status_t mbus_poll_frame(mbus_t mb_context, const uint8_t *frame, uint16_t size);
+
     mbus_status_t mbus_send(_stmodbus_context_t *ctx);
 
     mbus_status_t mbus_send_error(mbus_t mb_context, Modbus_ResponseType response);
@@ -301,4 +403,4 @@ extern "C"
 }
 #endif
 
-#endif // _STMODBUS_DEFINE_H_
\ No newline at end of file
+#endif // _STMODBUS_DEFINE_H_
@@ -102,5 +102,3 @@ uint16_t mbus_crc16(const uint16_t crc16, const uint8_t byte)
     const int index = (crc16 & 0xFF) ^ byte;
     return (aucCRCLo[index] << 8) | ((crc16 >> 8) ^ aucCRCHi[index]);
 }
-
-__attribute__((weak)) uint32_t mbus_tickcount() { return 0; }
\ No newline at end of file
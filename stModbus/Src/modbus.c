@@ -0,0 +1,895 @@
+/**
+ * stModbus Libary: A tiny Modbus implementation for Modbus ASCII/RTU
+ * Copyright (c) 2017+ [Iurii Bell] ds@inbox.ru (http://www.bel-tech.ru/)
+ * All rights reserved.
+ *
+ * [MIT License](http://www.opensource.org/licenses/mit-license.php)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @copyright   Copyright (C) 2017+
+ * @author      Iurii Bell (ds@inbox.ru)
+ * @license     MIT
+ * @package     stModbus
+ */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "modbus.h"
+
+#include <string.h>
+
+    // Global variable for modbus context
+    _stmodbus_context_t g_mbusContext[STMODBUS_COUNT_CONTEXT];
+    Modbus_ResponseType g_userError = MBUS_RESPONSE_OK;
+
+    static void mbus_reset(mbus_t mb_context);
+
+    /*
+     * function mbus_open()
+     * open new modbus context for new port
+     * return: MODBUS_ERROR - if can't open context
+     */
+    mbus_t mbus_open(Modbus_Conf_t *pconf)
+    {
+        mbus_t context;
+        stmbEnterCriticalSection();
+        for (context = 0; context < STMODBUS_COUNT_CONTEXT; context++)
+        {
+            if (g_mbusContext[context].open == 0)
+            {
+                break;
+            }
+        }
+        if (context == STMODBUS_COUNT_CONTEXT)
+        {
+            stmbLeaveCriticalSection();
+            return (mbus_t)MBUS_ERROR;
+        }
+        // Clear context
+        memset(&g_mbusContext[context], 0, sizeof(_stmodbus_context_t));
+        // Copy config to context
+        memcpy((void *)&g_mbusContext[context].conf, (void *)pconf,
+               sizeof(Modbus_Conf_t));
+
+        mbus_reset(context);
+        g_mbusContext[context].open = 1;
+        stmbLeaveCriticalSection();
+        return context;
+    }
+
+    /*
+     * function mbus_close()
+     * close modbus context
+     * return: none
+     */
+    void mbus_close(mbus_t mb_context)
+    {
+        if (mb_context < 0 || mb_context >= STMODBUS_COUNT_CONTEXT)
+            return;
+        stmbEnterCriticalSection();
+        g_mbusContext[mb_context].open = 0;
+        stmbLeaveCriticalSection();
+    }
+
+    /*
+     * function mbus_reset()
+     * drop a partial frame (parser context, no locking)
+     */
+    static void mbus_reset(mbus_t mb_context)
+    {
+        g_mbusContext[mb_context].crc16 = 0xFFFF;
+        g_mbusContext[mb_context].state = MBUS_STATE_IDLE;
+    }
+
+    /*
+     * function mbus_flush()
+     * drop a partial frame from outside the parser (e.g. a recovery path
+     * while the receive interrupt may be parsing)
+     */
+    mbus_status_t mbus_flush(const mbus_t context)
+    {
+        stmbEnterCriticalSection();
+        mbus_reset(context);
+        stmbLeaveCriticalSection();
+        return MBUS_OK;
+    }
+
+    /*
+     * function mbus_log_event()
+     * append one entry to the communication event log (FC12)
+     */
+    static void mbus_log_event(_stmodbus_context_t *ctx, uint8_t event)
+    {
+        ctx->diag.log[ctx->diag.log_head] = event;
+        ctx->diag.log_head = (ctx->diag.log_head + 1) % STMODBUS_EVENT_LOG_SIZE;
+        if (ctx->diag.log_count < STMODBUS_EVENT_LOG_SIZE)
+        {
+            ctx->diag.log_count++;
+        }
+    }
+
+    /*
+     * function mbus_log_receive()
+     * log a received frame, with any overrun since the previous one
+     */
+    static void mbus_log_receive(_stmodbus_context_t *ctx, uint8_t event)
+    {
+        if (ctx->diag.overrun_flag)
+        {
+            event |= MBUS_EVENT_RX_CHAR_OVERRUN;
+            ctx->diag.overrun_flag = 0;
+        }
+        mbus_log_event(ctx, MBUS_EVENT_RECEIVE | event);
+    }
+
+    /*
+     * function mbus_count_overrun()
+     * a frame or characters were lost because they could not be stored
+     */
+    static void mbus_count_overrun(_stmodbus_context_t *ctx)
+    {
+        ctx->diag.overruns++;
+        ctx->diag.overrun_flag = 1;
+    }
+
+    /*
+     * function mbus_char_overrun()
+     * UART receive overrun (interrupt context); the counters are single
+     * increments and need no lock
+     */
+    void mbus_char_overrun(const mbus_t context)
+    {
+        if (context < 0 || context >= STMODBUS_COUNT_CONTEXT)
+            return;
+        mbus_count_overrun(&g_mbusContext[context]);
+    }
+
+    static mbus_status_t mbus_read_file_record(mbus_t mb_context);
+    static mbus_status_t mbus_diagnostics(mbus_t mb_context);
+    static mbus_status_t mbus_comm_event_counter(mbus_t mb_context);
+    static mbus_status_t mbus_comm_event_log(mbus_t mb_context);
+
+    mbus_status_t mbus_response(mbus_t mb_context, Modbus_ResponseType response)
+    {
+
+        if (response != MBUS_RESPONSE_OK)
+        {
+            return mbus_send_error(mb_context, response);
+        }
+        else
+        {
+        }
+        return MBUS_ERROR;
+    }
+
+    uint16_t mbus_error(Modbus_ResponseType error)
+    {
+        g_userError = error;
+        return 0;
+    }
+
+    /*
+     * function mbus_read_file_record()
+     * FC20: each 7-byte sub-request (ref type 6, file, record, length) is answered
+     * with [1 + 2*length][6][registers...] using the read_file callback
+     */
+    static mbus_status_t mbus_read_file_record(mbus_t mb_context)
+    {
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        const uint8_t *req = ctx->conf.recvbuf;
+        uint8_t *out = &ctx->conf.sendbuf[3];
+        uint16_t len = 0;
+
+        if (ctx->conf.read_file == 0)
+        {
+            return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_FUNCTION);
+        }
+        if (ctx->header.size < 7 || ctx->header.size > 0xF5 || (ctx->header.size % 7) != 0)
+        {
+            return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+        }
+
+        g_userError = MBUS_RESPONSE_OK;
+        for (int i = 0; i < ctx->header.size; i += 7)
+        {
+            uint16_t file = (req[i + 1] << 8) | req[i + 2];
+            uint16_t record = (req[i + 3] << 8) | req[i + 4];
+            uint16_t count = (req[i + 5] << 8) | req[i + 6];
+
+            if (req[i] != 6 || record > 0x270F || count == 0 || (len + 2 + 2 * count) > 0xF5)
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+            }
+
+            out[len++] = 1 + 2 * count;
+            out[len++] = 6;
+            for (int j = 0; j < count; j++)
+            {
+                uint16_t d = ctx->conf.read_file(file, record + j);
+                out[len++] = d >> 8;
+                out[len++] = d & 0xFF;
+            }
+            if (g_userError != MBUS_RESPONSE_OK)
+            {
+                return mbus_response(mb_context, g_userError);
+            }
+        }
+
+        ctx->conf.sendbuf[0] = ctx->header.devaddr;
+        ctx->conf.sendbuf[1] = ctx->header.func;
+        ctx->conf.sendbuf[2] = len;
+        return mbus_send_data(mb_context, 3 + len);
+    }
+
+/* FC08 sub-functions answered here: 00-02, 0A-12 and 14 */
+#define MBUS_DIAG_SUPPORTED ((1UL << MBUS_DIAG_RETURN_QUERY_DATA) | (1UL << MBUS_DIAG_RESTART_COMM) | \
+                             (1UL << MBUS_DIAG_RETURN_REGISTER) | (0x1FFUL << MBUS_DIAG_CLEAR_COUNTERS) | \
+                             (1UL << MBUS_DIAG_CLEAR_OVERRUN))
+
+    /*
+     * function mbus_diagnostics()
+     * FC08: serial line counters. The request carries one data word, which
+     * the reply echoes or replaces with the counter asked for
+     */
+    static mbus_status_t mbus_diagnostics(mbus_t mb_context)
+    {
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        _stmodbus_diag_t *diag = &ctx->diag;
+        uint16_t sub = ctx->header.addr;
+        uint16_t data = ctx->header.num;
+
+        if (sub > MBUS_DIAG_CLEAR_OVERRUN || ((MBUS_DIAG_SUPPORTED >> sub) & 1) == 0)
+        {
+            return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_FUNCTION);
+        }
+        if (sub == MBUS_DIAG_RESTART_COMM ? (data != 0x0000 && data != 0xFF00)
+                                          : (sub != MBUS_DIAG_RETURN_QUERY_DATA && data != 0x0000))
+        {
+            return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+        }
+
+        switch (sub)
+        {
+        case MBUS_DIAG_RESTART_COMM:
+        case MBUS_DIAG_CLEAR_COUNTERS:
+            // FF00 also clears the event log; there is no listen-only mode to leave
+            if (sub == MBUS_DIAG_RESTART_COMM && data == 0xFF00)
+            {
+                diag->log_head = 0;
+                diag->log_count = 0;
+            }
+            diag->bus_messages = 0;
+            diag->comm_errors = 0;
+            diag->exceptions = 0;
+            diag->slave_messages = 0;
+            diag->no_responses = 0;
+            diag->busy = 0;
+            diag->overruns = 0;
+            diag->overrun_flag = 0;
+            diag->event_count = 0;
+            if (sub == MBUS_DIAG_RESTART_COMM)
+            {
+                mbus_log_event(ctx, MBUS_EVENT_COMM_RESTART);
+            }
+            break;
+        case MBUS_DIAG_BUS_MESSAGE_COUNT:
+            data = diag->bus_messages;
+            break;
+        case MBUS_DIAG_BUS_COMM_ERROR_COUNT:
+            data = diag->comm_errors;
+            break;
+        case MBUS_DIAG_EXCEPTION_COUNT:
+            data = diag->exceptions;
+            break;
+        case MBUS_DIAG_SLAVE_MESSAGE_COUNT:
+            data = diag->slave_messages;
+            break;
+        case MBUS_DIAG_NO_RESPONSE_COUNT:
+            data = diag->no_responses;
+            break;
+        case MBUS_DIAG_BUSY_COUNT:
+            data = diag->busy;
+            break;
+        case MBUS_DIAG_CHAR_OVERRUN_COUNT:
+            data = diag->overruns;
+            break;
+        case MBUS_DIAG_CLEAR_OVERRUN:
+            diag->overruns = 0;
+            diag->overrun_flag = 0;
+            break;
+        default:
+            // Query data is echoed; the diagnostic register and the NAK
+            // count stay 0 (no such conditions here)
+            break;
+        }
+
+        ctx->conf.sendbuf[0] = ctx->header.devaddr;
+        ctx->conf.sendbuf[1] = ctx->header.func;
+        ctx->conf.sendbuf[2] = sub >> 8;
+        ctx->conf.sendbuf[3] = sub & 0xFF;
+        ctx->conf.sendbuf[4] = data >> 8;
+        ctx->conf.sendbuf[5] = data & 0xFF;
+        return mbus_send_data(mb_context, 6);
+    }
+
+    /*
+     * function mbus_comm_event_counter()
+     * FC11: status word (never busy) and the event counter
+     */
+    static mbus_status_t mbus_comm_event_counter(mbus_t mb_context)
+    {
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+
+        ctx->conf.sendbuf[0] = ctx->header.devaddr;
+        ctx->conf.sendbuf[1] = ctx->header.func;
+        ctx->conf.sendbuf[2] = 0x00;
+        ctx->conf.sendbuf[3] = 0x00;
+        ctx->conf.sendbuf[4] = ctx->diag.event_count >> 8;
+        ctx->conf.sendbuf[5] = ctx->diag.event_count & 0xFF;
+        return mbus_send_data(mb_context, 6);
+    }
+
+    /*
+     * function mbus_comm_event_log()
+     * FC12: status word, event counter, bus message count and the event
+     * log, most recent entry first
+     */
+    static mbus_status_t mbus_comm_event_log(mbus_t mb_context)
+    {
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        uint8_t *out = ctx->conf.sendbuf;
+        uint8_t n = ctx->diag.log_count;
+        uint8_t i = ctx->diag.log_head;
+
+        out[0] = ctx->header.devaddr;
+        out[1] = ctx->header.func;
+        out[2] = 6 + n;
+        out[3] = 0x00;
+        out[4] = 0x00;
+        out[5] = ctx->diag.event_count >> 8;
+        out[6] = ctx->diag.event_count & 0xFF;
+        out[7] = ctx->diag.bus_messages >> 8;
+        out[8] = ctx->diag.bus_messages & 0xFF;
+        for (uint8_t k = 0; k < n; k++)
+        {
+            i = (i == 0) ? STMODBUS_EVENT_LOG_SIZE - 1 : i - 1;
+            out[9 + k] = ctx->diag.log[i];
+        }
+        return mbus_send_data(mb_context, 9 + n);
+    }
+
+    inline mbus_status_t mbus_poll_response(mbus_t mb_context)
+    {
+        stmbCallBackFunc func = 0;
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        int read = 1, la;
+        uint16_t d;
+
+        if (ctx->header.func == 0x04)
+        {
+            la = 10;
+        }
+
+#if STMODBUS_COUNT_FUNC > 0
+        for (int i = 0; i < STMODBUS_COUNT_FUNC; i++)
+        {
+            if ((ctx->func[i].code == ctx->response.func))
+            {
+                func = ctx->func[i].func;
+                break;
+            }
+        }
+#endif
+        switch (ctx->header.func)
+        {
+        case MBUS_FUNC_WRITE_COILS:
+        case MBUS_FUNC_READ_COILS:
+            if ((ctx->header.num == 0) || (ctx->header.num > 0x07D0))
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+            }
+            if ((ctx->header.addr + ctx->header.num) > ctx->conf.coils)
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+            }
+            break;
+        case MBUS_FUNC_READ_DISCRETE:
+            if ((ctx->header.num == 0) || (ctx->header.num > 0x07D0))
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+            }
+            if ((ctx->header.addr + ctx->header.num) > ctx->conf.discrete)
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+            }
+            break;
+        case MBUS_FUNC_READ_REGS:
+        case MBUS_FUNC_READ_INPUT_REGS:
+            // 125 registers fill a 256-byte frame; a smaller send buffer allows fewer
+            if ((ctx->header.num == 0) || (ctx->header.num > 0x007D) ||
+                (5 + 2 * ctx->header.num) > ctx->conf.sendbuf_sz)
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+            }
+            break;
+        case MBUS_FUNC_WRITE_REGS:
+            if ((ctx->header.num == 0) || (ctx->header.num > 0x007B) ||
+                ctx->header.size != 2 * ctx->header.num)
+            {
+                return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_DATA_VALUE);
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (func != 0)
+        {
+            return func(mb_context);
+        }
+
+        switch (ctx->header.func)
+        {
+        case MBUS_FUNC_READ_FILE_RECORD:
+            return mbus_read_file_record(mb_context);
+        case MBUS_FUNC_DIAGNOSTICS:
+            return mbus_diagnostics(mb_context);
+        case MBUS_FUNC_GET_COMM_EVENT_COUNTER:
+            return mbus_comm_event_counter(mb_context);
+        case MBUS_FUNC_GET_COMM_EVENT_LOG:
+            return mbus_comm_event_log(mb_context);
+        default:
+            break;
+        }
+
+        la = mbus_proto_address((Modbus_ConnectFuncType)ctx->header.func, (int *)&read);
+        if (la > 0)
+        {
+            la += ctx->header.addr;
+        }
+        if (la < 50001)
+        {
+            ctx->conf.sendbuf[0] = ctx->header.devaddr;
+            ctx->conf.sendbuf[1] = ctx->header.func;
+            ctx->conf.sendbuf[2] = ctx->header.num * 2;
+            if (read && ctx->conf.read && (ctx->header.func == MBUS_FUNC_READ_COILS ||
+                                           ctx->header.func == MBUS_FUNC_READ_DISCRETE))
+            {
+                // Bit-packed response: LSB of the first data byte is the first coil/input
+                ctx->conf.sendbuf[2] = (ctx->header.num + 7) >> 3;
+                // 2000 bits need 255 bytes; a smaller send buffer cannot hold them
+                if (3 + ctx->conf.sendbuf[2] + 2 > ctx->conf.sendbuf_sz)
+                {
+                    return mbus_response(mb_context, MBUS_RESPONSE_SERVICE_DEVICE_FAILURE);
+                }
+                memset(&ctx->conf.sendbuf[3], 0, ctx->conf.sendbuf[2]);
+                g_userError = MBUS_RESPONSE_OK;
+                for (int i = 0; i < ctx->header.num; i++)
+                {
+                    if (ctx->conf.read(la + i))
+                    {
+                        ctx->conf.sendbuf[3 + (i >> 3)] |= 1 << (i & 7);
+                    }
+                }
+                if (g_userError == MBUS_RESPONSE_OK)
+                {
+                    return mbus_send_data(mb_context, 3 + ctx->conf.sendbuf[2]);
+                }
+                return mbus_response(mb_context, g_userError);
+            }
+            else if (read && ctx->conf.read)
+            {
+                g_userError = MBUS_RESPONSE_OK;
+                for (int i = 0; i < ctx->header.num; i++)
+                {
+
+                    d = ctx->conf.read(la + i);
+                    ctx->conf.sendbuf[3 + (i << 1)] = d >> 8;
+                    ctx->conf.sendbuf[3 + (i << 1) + 1] = d & 0xFF;
+                }
+                if (g_userError == MBUS_RESPONSE_OK)
+                {
+                    return mbus_send_data(mb_context, 3 + ctx->conf.sendbuf[2]);
+                }
+                else
+                {
+                    return mbus_response(mb_context, g_userError);
+                }
+            }
+            else if (ctx->conf.write)
+            {
+                uint16_t *value;
+                ctx->conf.sendbuf[2] = 0;
+                switch (ctx->header.func)
+                {
+                case MBUS_FUNC_WRITE_REG:
+                case MBUS_FUNC_WRITE_COIL:
+                    // in both these cases, we should return the same packet that we
+                    // received. in both cases, the packes have 6 bytes of data + 2 CRC
+                    // bytes = 8 bytes
+                    value = (uint16_t *)ctx->conf.recvbuf;
+                    g_userError = MBUS_RESPONSE_OK;
+                    ctx->conf.write(la, *value);
+                    if (g_userError != MBUS_RESPONSE_OK)
+                    {
+                        return mbus_response(mb_context, g_userError);
+                    }
+                    ctx->conf.sendbuf[2] = ctx->header.addr >> 8;
+                    ctx->conf.sendbuf[3] = ctx->header.addr & 0xFF;
+                    ctx->conf.sendbuf[4] = ctx->conf.recvbuf[1];
+                    ctx->conf.sendbuf[5] = ctx->conf.recvbuf[0];
+                    return mbus_send_data(mb_context, 6);
+
+                case MBUS_FUNC_WRITE_REGS:
+                    // The values arrive as a byte block, high byte first
+                    g_userError = MBUS_RESPONSE_OK;
+                    for (int i = 0; i < ctx->header.num; i++)
+                    {
+                        ctx->conf.write(la + i, (ctx->conf.recvbuf[2 * i] << 8) | ctx->conf.recvbuf[2 * i + 1]);
+                    }
+                    if (g_userError != MBUS_RESPONSE_OK)
+                    {
+                        return mbus_response(mb_context, g_userError);
+                    }
+                    ctx->conf.sendbuf[2] = ctx->header.addr >> 8;
+                    ctx->conf.sendbuf[3] = ctx->header.addr & 0xFF;
+                    ctx->conf.sendbuf[4] = ctx->header.num >> 8;
+                    ctx->conf.sendbuf[5] = ctx->header.num & 0xFF;
+                    return mbus_send_data(mb_context, 6);
+                } // end of switch
+            }
+        }
+        return mbus_response(mb_context, MBUS_RESPONSE_ILLEGAL_FUNCTION);
+    }
+
+    /*
+     * function mbus_poll()
+     * feed one received byte to the parser, answer a complete frame
+     * return: MBUS_ERROR on a bad frame or a failed reply
+     */
+    mbus_status_t mbus_poll(mbus_t mb_context, uint8_t byte)
+    {
+        // State machine
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+
+        if (mbport_tickcount() - ctx->timer > 4)
+        {
+            mbus_reset(mb_context);
+        }
+        ctx->timer = mbport_tickcount();
+
+        switch (ctx->state)
+        {
+        case MBUS_STATE_IDLE:
+            mbus_reset(mb_context);
+            ctx->state = MBUS_STATE_FUNCTION;
+            ctx->header.devaddr = byte;
+            break;
+        case MBUS_STATE_FUNCTION:
+            ctx->header.func = byte;
+            switch (byte)
+            {
+            case MBUS_FUNC_WRITE_REG:
+                ctx->header.rnum = 1;
+                ctx->header.num = 1;
+                ctx->state = MBUS_STATE_REGADDR_HI;
+                break;
+            case MBUS_FUNC_WRITE_REGS:
+            case MBUS_FUNC_WRITE_COILS:
+                ctx->header.rnum = 1;
+                ctx->header.num = 0;
+                ctx->state = MBUS_STATE_REGADDR_HI;
+                break;
+            case MBUS_FUNC_READ_INPUT_REGS:
+            case MBUS_FUNC_READ_DISCRETE:
+            case MBUS_FUNC_READ_COILS:
+            case MBUS_FUNC_READ_REGS:
+            case MBUS_FUNC_DIAGNOSTICS:
+                // FC08: sub-function and one data word in the address / count fields
+                ctx->state = MBUS_STATE_REGADDR_HI;
+                ctx->header.rnum = 0;
+                ctx->header.num = 0;
+                break;
+            case MBUS_FUNC_WRITE_COIL:
+                ctx->header.rnum = 1;
+                ctx->header.num = 1;
+                ctx->state = MBUS_STATE_REGADDR_HI;
+                break;
+            case MBUS_FUNC_READ_FILE_RECORD:
+                // Byte count followed by 7-byte sub-requests
+                ctx->state = MBUS_STATE_DATA_SIZE;
+                break;
+            case MBUS_FUNC_GET_COMM_EVENT_COUNTER:
+            case MBUS_FUNC_GET_COMM_EVENT_LOG:
+                // No data
+                ctx->state = MBUS_STATE_CRC_LO;
+                break;
+            default:
+                // ctx->state = MBUS_STATE_IDLE;
+                mbus_reset(mb_context);
+                break;
+            }
+            break;
+        case MBUS_STATE_REGADDR_HI:
+            ctx->state = MBUS_STATE_REGADDR_LO;
+            ctx->header.addr = byte << 8;
+            break;
+        case MBUS_STATE_REGADDR_LO:
+            ctx->header.addr |= byte;
+            if (ctx->header.num == 1 && ctx->header.rnum == 1)
+            {
+                ctx->state = MBUS_STATE_DATA_HI;
+            }
+            else
+            {
+                ctx->state = MBUS_STATE_REGNUM_HI;
+            }
+            break;
+        case MBUS_STATE_DATA_HI:
+            ctx->state = MBUS_STATE_DATA_LO;
+            ctx->conf.recvbuf[2 * (ctx->header.num - ctx->header.rnum) + 1] = byte;
+            break;
+        case MBUS_STATE_DATA_LO:
+            ctx->conf.recvbuf[2 * (ctx->header.num - ctx->header.rnum)] = byte;
+            ctx->header.rnum--;
+            if (ctx->header.rnum == 0)
+            {
+                ctx->state = MBUS_STATE_CRC_LO;
+            }
+            else
+            {
+                ctx->state = MBUS_STATE_DATA_HI;
+            }
+            break;
+        case MBUS_STATE_DATA_SIZE:
+            if (byte > ctx->conf.recvbuf_sz)
+            {
+                mbus_count_overrun(ctx);
+                mbus_reset(mb_context);
+                return MBUS_ERROR;
+            }
+            ctx->state = (byte == 0) ? MBUS_STATE_CRC_LO : MBUS_STATE_DATA;
+            ctx->header.size = byte;
+            ctx->header.rsize = byte;
+            break;
+        case MBUS_STATE_DATA:
+            ctx->conf.recvbuf[ctx->header.size - ctx->header.rsize] = byte;
+            ctx->header.rsize--;
+            if (ctx->header.rsize == 0)
+            {
+                ctx->state = MBUS_STATE_CRC_LO;
+            }
+            break;
+        case MBUS_STATE_REGNUM_HI:
+            ctx->state = MBUS_STATE_REGNUM_LO;
+            ctx->header.num = byte << 8;
+            break;
+        case MBUS_STATE_REGNUM_LO:
+            ctx->state = MBUS_STATE_CRC_LO;
+            ctx->header.num |= byte;
+            if (ctx->header.rnum == 0)
+            {
+                ctx->state = MBUS_STATE_CRC_LO;
+            }
+            else if (2 * ctx->header.num > ctx->conf.recvbuf_sz)
+            {
+                // The values would not fit in the receive buffer
+                mbus_count_overrun(ctx);
+                mbus_reset(mb_context);
+                return MBUS_ERROR;
+            }
+            else
+            {
+                ctx->header.rnum = ctx->header.num;
+                ctx->state = MBUS_STATE_DATA_HI;
+                if (ctx->header.func == MBUS_FUNC_WRITE_REGS)
+                {
+                    ctx->state = MBUS_STATE_DATA_SIZE;
+                }
+            }
+
+            break;
+        case MBUS_STATE_CRC_LO:
+            ctx->state = MBUS_STATE_CRC_HI;
+            break;
+        case MBUS_STATE_CRC_HI:
+            ctx->state = MBUS_STATE_FINISH;
+            break;
+        // We can't processing any more before callback not returned
+        case MBUS_STATE_RESPONSE:
+            return MBUS_ERROR;
+        default:
+            mbus_reset(mb_context);
+            break;
+        }
+
+        ctx->crc16 = mbus_crc16(ctx->crc16, byte);
+
+        if (ctx->state == MBUS_STATE_FINISH)
+        {
+            // CRC error
+            if (ctx->crc16 != 0)
+            {
+                STMODBUS_TRACE_CRC_FAIL(ctx->header.func);
+                ctx->diag.comm_errors++;
+                mbus_log_receive(ctx, MBUS_EVENT_RX_COMM_ERROR);
+                mbus_reset(mb_context);
+                return MBUS_ERROR;
+            }
+            ctx->diag.bus_messages++;
+
+            // TODO: Add broadcast messages
+            if (ctx->header.devaddr == ctx->conf.devaddr)
+            {
+                ctx->state = MBUS_STATE_RESPONSE;
+                ctx->diag.slave_messages++;
+                mbus_log_receive(ctx, 0);
+                STMODBUS_PROF_MARK(MBUS_PROF_PARSED, ctx->header.func);
+                if (mbus_poll_response(mb_context) == MBUS_OK)
+                {
+                    mbus_reset(mb_context);
+                    return MBUS_OK;
+                }
+                ctx->diag.no_responses++;
+                mbus_reset(mb_context);
+                return MBUS_ERROR;
+            }
+            mbus_reset(mb_context);
+        }
+        return MBUS_OK;
+    }
+
+    /*
+     * function mbus_poll_frame()
+     * parse one idle-line delimited frame; the line went silent before it,
+     * so any partial frame from before is dropped
+     */
+    mbus_status_t mbus_poll_frame(mbus_t mb_context, const uint8_t *frame, uint16_t size)
+    {
+        mbus_status_t status = MBUS_OK;
+
+        STMODBUS_PROF_MARK(MBUS_PROF_FRAME, 0);
+        mbus_reset(mb_context);
+        for (uint16_t i = 0; i < size; i++)
+        {
+            status = mbus_poll(mb_context, frame[i]);
+        }
+        return status;
+    }
+
+    mbus_context_t mbus_device(mbus_t mb_context)
+    {
+        return (mbus_context_t)&g_mbusContext[mb_context];
+    }
+
+    mbus_context_t mbus_context(mbus_t mb_context)
+    {
+        if (g_mbusContext[mb_context].open)
+            return (mbus_context_t)&g_mbusContext[mb_context];
+        return 0;
+    }
+
+    mbus_status_t mbus_send_error(mbus_t mb_context, Modbus_ResponseType response)
+    {
+        // Exception frame: address, function | 0x80, exception code
+        const _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        ctx->conf.sendbuf[0] = ctx->header.devaddr;
+        ctx->conf.sendbuf[1] = ctx->header.func | 0x80;
+        ctx->conf.sendbuf[2] = (uint8_t)response;
+        return mbus_send_data(mb_context, 3);
+    }
+
+    mbus_status_t mbus_send_data(mbus_t mb_context, uint16_t size)
+    {
+        // if size > ( conf.send_sz-2) error
+        uint16_t crc32 = 0xFFFF;
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        uint8_t *pbuf = ctx->conf.sendbuf;
+        if (ctx->conf.send == 0 || pbuf == 0 || ctx->conf.sendbuf_sz < (size + 2))
+            return MBUS_ERROR;
+        STMODBUS_PROF_MARK(MBUS_PROF_BUILT, ctx->header.func);
+        for (int i = 0; i < size; i++)
+        {
+            crc32 = mbus_crc16(crc32, pbuf[i]);
+        }
+        pbuf[size++] = crc32 & 0xFF;
+        pbuf[size++] = (crc32 >> 8);
+        STMODBUS_PROF_MARK(MBUS_PROF_CRC, ctx->header.func);
+
+        if (ctx->conf.send(mb_context, pbuf, size) != size)
+            return MBUS_ERROR;
+
+        // Event counter and log (FC11 / FC12)
+        if (pbuf[1] & 0x80)
+        {
+            uint8_t code = pbuf[2];
+            ctx->diag.exceptions++;
+            if (code == MBUS_RESPONSE_SLAVE_DEVICE_BUSY)
+                ctx->diag.busy++;
+            mbus_log_event(ctx, MBUS_EVENT_SEND | (code <= 3   ? MBUS_EVENT_TX_READ_EXCEPTION
+                                                   : code == 4 ? MBUS_EVENT_TX_ABORT_EXCEPTION
+                                                   : code <= 6 ? MBUS_EVENT_TX_BUSY_EXCEPTION
+                                                               : MBUS_EVENT_TX_NAK_EXCEPTION));
+        }
+        else
+        {
+            if (pbuf[1] != MBUS_FUNC_GET_COMM_EVENT_COUNTER && pbuf[1] != MBUS_FUNC_GET_COMM_EVENT_LOG)
+                ctx->diag.event_count++;
+            mbus_log_event(ctx, MBUS_EVENT_SEND);
+        }
+        return MBUS_OK;
+    }
+
+    mbus_status_t mbus_connect(const mbus_t mb_context, stmbCallBackFunc func,
+                               Modbus_ConnectFuncType type)
+    {
+#if STMODBUS_COUNT_FUNC > 0
+        _stmodbus_context_t *ctx = &g_mbusContext[mb_context];
+        for (int i = 0; i < STMODBUS_COUNT_FUNC; i++)
+        {
+            if ((ctx->func[i].code == 0))
+            {
+                ctx->func[i].func = func;
+                ctx->func[i].code = (uint8_t)type;
+                return MBUS_OK;
+            }
+        }
+#endif
+        return MBUS_ERROR;
+    }
+
+    int mbus_proto_address(Modbus_ConnectFuncType func, int *r)
+    {
+        int adr = 0;
+        *r = 1;
+        switch (func)
+        {
+        case MBUS_FUNC_WRITE_REG:
+        case MBUS_FUNC_WRITE_REGS:
+        case MBUS_FUNC_READ_WRITE_MASK_REGS:
+        case MBUS_FUNC_READ_WRITE_REGS:
+            *r = 0;
+        case MBUS_FUNC_READ_REGS:
+            adr = 40001;
+            break;
+        case MBUS_FUNC_READ_INPUT_REGS:
+            adr = 30001;
+            break;
+        case MBUS_FUNC_READ_DISCRETE:
+            adr = 10001;
+            break;
+        case MBUS_FUNC_WRITE_COILS:
+        case MBUS_FUNC_WRITE_COIL:
+            *r = 0;
+        case MBUS_FUNC_READ_COILS:
+            adr = 0001;
+            break;
+        default:
+            break;
+        }
+        return adr;
+    }
+
+#ifdef __cplusplus
+}
+#endif
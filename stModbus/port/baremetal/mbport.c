@@ -0,0 +1,42 @@
+/**
+ * @file    mbport.c
+ * @brief   stModbus port for bare-metal builds (main loop + interrupts)
+ *
+ * Critical sections mask interrupts through PRIMASK and restore the state
+ * found on entry, so they nest and may be used with interrupts already
+ * masked. The bare-metal builds parse each frame in the receive interrupt
+ * and send the reply from there, so there is no frame queue and no
+ * transmit wait to provide.
+ */
+
+#include "mbport.h"
+#include "main.h"
+
+/* Private variables */
+static uint32_t mbport_primask;  // PRIMASK found by the outermost enter
+static uint32_t mbport_nesting;  // Depth of nested critical sections
+
+/* Exported functions */
+
+void mbport_enter_critical(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (mbport_nesting++ == 0)
+    {
+        mbport_primask = primask;
+    }
+}
+
+void mbport_exit_critical(void)
+{
+    if (--mbport_nesting == 0)
+    {
+        __set_PRIMASK(mbport_primask);
+    }
+}
+
+uint32_t mbport_tickcount(void)
+{
+    return HAL_GetTick();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    mbport.c
+ * @brief   stModbus port for FreeRTOS builds (CMSIS-RTOS v2)
+ *
+ * Critical sections are the kernel's, so they nest and leave interrupts
+ * above configMAX_SYSCALL_INTERRUPT_PRIORITY running. Frames go from the
+ * receive interrupt to the parsing task through a statically allocated
+ * message buffer (one message per frame); the task sleeps while it waits
+ * for a frame and for the end of a transmission.
+ */
+
+#include "mbport.h"
+#include "cmsis_os.h"
+#include "task.h"
+#include "message_buffer.h"
+
+/* Private defines */
+#define MBPORT_FLAG_TX_DONE 0x0001U // Thread flag set when the last byte has left the UART
+
+/* Private variables */
+static uint8_t mbport_queue_storage[STMODBUS_QUEUE_SIZE + 1];
+static StaticMessageBuffer_t mbport_queue_struct;
+static MessageBufferHandle_t mbport_queue;
+static osThreadId_t mbport_tx_thread; // Task waiting for the transmission to finish
+
+/* Private functions */
+
+static TickType_t mbport_ticks(uint32_t timeout_ms)
+{
+    return (timeout_ms == MBPORT_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+}
+
+/* Exported functions */
+
+void mbport_enter_critical(void)
+{
+    taskENTER_CRITICAL();
+}
+
+void mbport_exit_critical(void)
+{
+    taskEXIT_CRITICAL();
+}
+
+uint32_t mbport_tickcount(void)
+{
+    return osKernelGetTickCount();
+}
+
+void mbport_queue_init(void)
+{
+    mbport_queue = xMessageBufferCreateStatic(sizeof(mbport_queue_storage),
+                                              mbport_queue_storage,
+                                              &mbport_queue_struct);
+}
+
+uint8_t mbport_queue_put_from_isr(const uint8_t *frame, uint16_t size)
+{
+    BaseType_t woken = pdFALSE;
+    size_t sent = 0;
+
+    if (size > 0)
+    {
+        sent = xMessageBufferSendFromISR(mbport_queue, frame, size, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+    return sent != 0;
+}
+
+uint16_t mbport_queue_get(uint8_t *frame, uint16_t size, uint32_t timeout_ms)
+{
+    return (uint16_t)xMessageBufferReceive(mbport_queue, frame, size, mbport_ticks(timeout_ms));
+}
+
+void mbport_transmit_begin(void)
+{
+    mbport_tx_thread = osThreadGetId();
+    osThreadFlagsClear(MBPORT_FLAG_TX_DONE);
+}
+
+void mbport_transmit_done_from_isr(void)
+{
+    if (mbport_tx_thread != NULL)
+    {
+        osThreadFlagsSet(mbport_tx_thread, MBPORT_FLAG_TX_DONE);
+    }
+}
+
+uint8_t mbport_transmit_wait(uint32_t timeout_ms)
+{
+    uint32_t timeout = (timeout_ms == MBPORT_WAIT_FOREVER) ? osWaitForever : timeout_ms;
+
+    return (osThreadFlagsWait(MBPORT_FLAG_TX_DONE, osFlagsWaitAny, timeout) & osFlagsError) == 0;
+}
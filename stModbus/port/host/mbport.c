@@ -0,0 +1,81 @@
+/**
+ * @file    mbport.c
+ * @brief   stModbus port for host builds (tests, benchmarks)
+ *
+ * Single-threaded: critical sections do nothing, the "interrupt" is the
+ * test driver calling mbport_queue_put_from_isr(), and a transmission is
+ * complete as soon as the send callback returns. The tick is the monotonic
+ * clock, so the inter-character timeout behaves as on the target.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "mbport.h"
+#include <string.h>
+#include <time.h>
+
+/* Private variables */
+static uint8_t mbport_frame[STMODBUS_MAX_FRAME_SIZE];
+static uint16_t mbport_frame_size; // 0 = mailbox empty
+
+/* Exported functions */
+
+void mbport_enter_critical(void)
+{
+}
+
+void mbport_exit_critical(void)
+{
+}
+
+uint32_t mbport_tickcount(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000);
+}
+
+void mbport_queue_init(void)
+{
+    mbport_frame_size = 0;
+}
+
+uint8_t mbport_queue_put_from_isr(const uint8_t *frame, uint16_t size)
+{
+    if (mbport_frame_size != 0 || size == 0 || size > sizeof(mbport_frame))
+    {
+        return 0;
+    }
+    memcpy(mbport_frame, frame, size);
+    mbport_frame_size = size;
+    return 1;
+}
+
+uint16_t mbport_queue_get(uint8_t *frame, uint16_t size, uint32_t timeout_ms)
+{
+    (void)timeout_ms; // Nothing else can fill the queue while we wait
+
+    uint16_t n = mbport_frame_size;
+    if (n > size)
+    {
+        n = size;
+    }
+    memcpy(frame, mbport_frame, n);
+    mbport_frame_size = 0;
+    return n;
+}
+
+void mbport_transmit_begin(void)
+{
+}
+
+void mbport_transmit_done_from_isr(void)
+{
+}
+
+uint8_t mbport_transmit_wait(uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    return 1;
+}
@@ -0,0 +1,13 @@
+/**
+ * @file    modbus_conf.h
+ * @brief   stModbus configuration for the host tests and benchmarks
+ */
+
+#ifndef _MODBUS_CONF_H_
+#define _MODBUS_CONF_H_
+
+#define STMODBUS_USE_CRITICAL_SECTIONS 1
+#define STMODBUS_COUNT_CONTEXT 1
+#define STMODBUS_COUNT_FUNC 0
+
+#endif // _MODBUS_CONF_H_
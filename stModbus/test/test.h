@@ -0,0 +1,30 @@
+/**
+ * @file    test.h
+ * @brief   Minimal check helpers shared by the host tests
+ */
+
+#ifndef _STMODBUS_TEST_H_
+#define _STMODBUS_TEST_H_
+
+#include <stdio.h>
+
+static int test_failures;
+
+#define CHECK(cond, name)                                              \
+    do                                                                 \
+    {                                                                  \
+        if (cond)                                                      \
+        {                                                              \
+            printf("ok   %s\n", name);                                 \
+        }                                                              \
+        else                                                           \
+        {                                                              \
+            printf("FAIL %s (%s:%d)\n", name, __FILE__, __LINE__);     \
+            test_failures++;                                           \
+        }                                                              \
+    } while (0)
+
+// Exit status of a test program
+#define TEST_RESULT() (test_failures ? 1 : 0)
+
+#endif // _STMODBUS_TEST_H_
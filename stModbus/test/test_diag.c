@@ -0,0 +1,285 @@
+/**
+ * @file    test_diag.c
+ * @brief   Host conformance test of FC08 diagnostics and FC11/FC12 events
+ *
+ * Counts follow the Modbus serial line specification: bus messages are
+ * frames with a good CRC for any address, slave messages those for this
+ * device, and the event counter only advances on requests completed
+ * without an exception. Holding registers 40001-40050 exist, 40100 answers
+ * busy, everything else is an illegal address.
+ */
+
+#include "modbus.h"
+#include "test.h"
+#include <string.h>
+
+/* Private variables */
+static uint16_t holding[50];
+static uint8_t tx_buffer[STMODBUS_MAX_FRAME_SIZE];
+static uint8_t rx_frame[STMODBUS_MAX_FRAME_SIZE];
+static uint8_t reply[STMODBUS_MAX_FRAME_SIZE];
+static int reply_size;
+
+/* Requests used throughout */
+static const uint8_t fc03[] = {1, 3, 0, 0, 0, 2};
+static const uint8_t fc11[] = {1, 11};
+static const uint8_t fc12[] = {1, 12};
+static const uint8_t bad_crc[] = {1, 3, 0, 0, 0, 1, 0, 0};
+
+/* Private functions */
+
+static uint16_t dev_read(uint32_t la)
+{
+    if (la >= 40001 && la < 40051)
+        return holding[la - 40001];
+    if (la == 40100)
+    {
+        mbus_error(MBUS_RESPONSE_SLAVE_DEVICE_BUSY);
+        return 0;
+    }
+    mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+    return 0;
+}
+
+static uint16_t dev_write(uint32_t la, uint16_t value)
+{
+    if (la >= 40001 && la < 40051)
+    {
+        holding[la - 40001] = value;
+        return value;
+    }
+    mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+    return 0;
+}
+
+static int dev_send(const mbus_t context, const uint8_t *data, uint16_t size)
+{
+    memcpy(reply, data, size);
+    reply_size = size;
+    return size;
+}
+
+static uint16_t frame_crc(const uint8_t *data, int size)
+{
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < size; i++)
+        crc = mbus_crc16(crc, data[i]);
+    return crc;
+}
+
+// Append the CRC, parse the frame, return the reply size (0 = no reply)
+static int request(mbus_t ctx, const uint8_t *pdu, int size)
+{
+    uint16_t crc;
+
+    memcpy(rx_frame, pdu, size);
+    crc = frame_crc(rx_frame, size);
+    rx_frame[size] = crc & 0xFF;
+    rx_frame[size + 1] = crc >> 8;
+
+    reply_size = 0;
+    mbus_poll_frame(ctx, rx_frame, size + 2);
+    return reply_size;
+}
+
+// Frame that never reaches a reply: bad CRC or rejected by the parser
+static void raw_frame(mbus_t ctx, const uint8_t *frame, int size)
+{
+    memcpy(rx_frame, frame, size);
+    reply_size = 0;
+    mbus_poll_frame(ctx, rx_frame, size);
+}
+
+// FC08 counter sub-function, 0xFFFF if the reply is malformed
+static uint16_t diag_counter(mbus_t ctx, uint16_t sub)
+{
+    const uint8_t pdu[] = {1, 8, sub >> 8, sub & 0xFF, 0, 0};
+    int n = request(ctx, pdu, sizeof(pdu));
+
+    if (n != 8 || reply[1] != 8 || reply[2] != (sub >> 8) || reply[3] != (sub & 0xFF) || frame_crc(reply, n) != 0)
+    {
+        printf("bad FC08 reply to sub-function %04X (%d bytes)\n", sub, n);
+        return 0xFFFF;
+    }
+    return (reply[4] << 8) | reply[5];
+}
+
+static uint16_t reply_word(int offset)
+{
+    return (reply[offset] << 8) | reply[offset + 1];
+}
+
+static mbus_t open_device(Modbus_Conf_t *conf)
+{
+    memset(conf, 0, sizeof(*conf));
+    conf->devaddr = 1;
+    conf->send = dev_send;
+    conf->read = dev_read;
+    conf->write = dev_write;
+    conf->sendbuf = tx_buffer;
+    conf->sendbuf_sz = sizeof(tx_buffer);
+    conf->recvbuf = rx_frame;
+    conf->recvbuf_sz = sizeof(rx_frame);
+    return mbus_open(conf);
+}
+
+/* Tests */
+
+static void test_counters(mbus_t ctx)
+{
+    int n;
+
+    const uint8_t query[] = {1, 8, 0, 0, 0xA5, 0x37};
+    n = request(ctx, query, sizeof(query));
+    CHECK(n == 8 && !memcmp(reply, query, sizeof(query)) && frame_crc(reply, 8) == 0,
+          "08/00 return query data echoes");
+
+    request(ctx, fc03, sizeof(fc03));
+    request(ctx, fc03, sizeof(fc03));
+    const uint8_t other[] = {2, 3, 0, 0, 0, 1};
+    request(ctx, other, sizeof(other));
+    raw_frame(ctx, bad_crc, sizeof(bad_crc));
+
+    const uint8_t illegal[] = {1, 3, 0, 60, 0, 1};
+    n = request(ctx, illegal, sizeof(illegal));
+    CHECK(n == 5 && reply[1] == 0x83 && reply[2] == 2, "exception reply");
+
+    const uint8_t busy[] = {1, 3, 0, 99, 0, 1};
+    n = request(ctx, busy, sizeof(busy));
+    CHECK(n == 5 && reply[2] == 6, "busy exception reply");
+
+    // Bus messages so far: query, 2 x FC03, other address, illegal, busy,
+    // plus each counter request itself
+    CHECK(diag_counter(ctx, 0x0B) == 7, "08/0B bus message count (bad CRC excluded)");
+    CHECK(diag_counter(ctx, 0x0C) == 1, "08/0C CRC error count");
+    CHECK(diag_counter(ctx, 0x0D) == 2, "08/0D exception count");
+    CHECK(diag_counter(ctx, 0x0E) == 9, "08/0E slave message count (other address excluded)");
+    CHECK(diag_counter(ctx, 0x0F) == 0, "08/0F no-response count");
+    CHECK(diag_counter(ctx, 0x11) == 1, "08/11 busy count");
+    CHECK(diag_counter(ctx, 0x10) == 0, "08/10 NAK count");
+    CHECK(diag_counter(ctx, 0x02) == 0, "08/02 diagnostic register");
+
+    // Two UART overruns and one frame too long for the receive buffer
+    const uint8_t fc15_big[] = {1, 15, 0, 0, 0xFF, 0xFF};
+    mbus_char_overrun(ctx);
+    mbus_char_overrun(ctx);
+    raw_frame(ctx, fc15_big, sizeof(fc15_big));
+    CHECK(diag_counter(ctx, 0x12) == 3, "08/12 overrun count (UART + buffer)");
+    CHECK(diag_counter(ctx, 0x14) == 0 && diag_counter(ctx, 0x12) == 0, "08/14 clears the overrun count");
+}
+
+static void test_exceptions(mbus_t ctx)
+{
+    int n;
+
+    const uint8_t listen_only[] = {1, 8, 0, 4, 0, 0};
+    n = request(ctx, listen_only, sizeof(listen_only));
+    CHECK(n == 5 && reply[1] == 0x88 && reply[2] == 1, "08/04 listen only -> exception 1");
+
+    const uint8_t sub15[] = {1, 8, 0, 0x15, 0, 0};
+    n = request(ctx, sub15, sizeof(sub15));
+    CHECK(n == 5 && reply[2] == 1, "08/15 -> exception 1");
+
+    const uint8_t sub10b[] = {1, 8, 1, 0x0B, 0, 0};
+    n = request(ctx, sub10b, sizeof(sub10b));
+    CHECK(n == 5 && reply[2] == 1, "08/010B -> exception 1");
+
+    const uint8_t count_data[] = {1, 8, 0, 0x0B, 0, 1};
+    n = request(ctx, count_data, sizeof(count_data));
+    CHECK(n == 5 && reply[2] == 3, "08/0B data not 0000 -> exception 3");
+
+    const uint8_t restart_data[] = {1, 8, 0, 1, 0x12, 0};
+    n = request(ctx, restart_data, sizeof(restart_data));
+    CHECK(n == 5 && reply[2] == 3, "08/01 data not 0000/FF00 -> exception 3");
+}
+
+static void test_event_log(mbus_t ctx)
+{
+    int n;
+
+    n = request(ctx, fc11, sizeof(fc11));
+    CHECK(n == 8 && reply[1] == 11 && reply_word(2) == 0 && reply_word(4) == 0 && frame_crc(reply, 8) == 0,
+          "FC11 after exceptions only: 0 events");
+
+    const uint8_t fc06[] = {1, 6, 0, 1, 0, 7};
+    request(ctx, fc03, sizeof(fc03));
+    request(ctx, fc06, sizeof(fc06));
+    n = request(ctx, fc11, sizeof(fc11));
+    CHECK(n == 8 && reply_word(4) == 2, "FC11 counts successful requests, not itself");
+
+    // Newest first: rx FC12, tx FC11, rx FC11, tx FC06, rx FC06, tx FC03,
+    // rx FC03, tx FC11, rx FC11, tx exception (08/01 data), ...
+    n = request(ctx, fc12, sizeof(fc12));
+    CHECK(n >= 5 + 9 && reply[1] == 12 && frame_crc(reply, n) == 0, "FC12 reply");
+    CHECK(reply[2] == n - 5 && reply[2] >= 6, "FC12 byte count");
+    CHECK(reply_word(3) == 0, "FC12 status");
+    CHECK(reply_word(5) == 2, "FC12 event count");
+    CHECK(reply_word(7) == 10, "FC12 message count = bus message count");
+    CHECK(reply[9] == 0x80 && reply[10] == 0x40 && reply[11] == 0x80 && reply[12] == 0x40,
+          "FC12 newest first: rx, tx, rx, tx");
+    CHECK(reply[9 + 7] == 0x40 && reply[9 + 8] == 0x80 && reply[9 + 9] == 0x41,
+          "FC12 exception send event has the read-exception bit");
+
+    mbus_char_overrun(ctx);
+    request(ctx, fc03, sizeof(fc03));
+    request(ctx, fc12, sizeof(fc12));
+    CHECK(reply[9] == 0x80 && reply[10] == 0x40 && reply[11] == 0x90, "receive event carries the overrun bit");
+
+    raw_frame(ctx, bad_crc, sizeof(bad_crc));
+    request(ctx, fc12, sizeof(fc12));
+    CHECK(reply[10] == 0x82, "CRC error logged as a receive event with the comm error bit");
+
+    for (int i = 0; i < 40; i++)
+        request(ctx, fc03, sizeof(fc03));
+    n = request(ctx, fc12, sizeof(fc12));
+    CHECK(reply[2] == 6 + 64 && n == 9 + 64 + 2, "FC12 log capped at 64 entries");
+}
+
+static void test_restart_and_clear(mbus_t ctx)
+{
+    int n;
+
+    const uint8_t restart[] = {1, 8, 0, 1, 0xFF, 0};
+    n = request(ctx, restart, sizeof(restart));
+    CHECK(n == 8 && !memcmp(reply, restart, sizeof(restart)), "08/01 FF00 echo");
+
+    request(ctx, fc12, sizeof(fc12));
+    CHECK(reply[2] == 6 + 3 && reply[9] == 0x80 && reply[10] == 0x40 && reply[11] == 0x00,
+          "log after restart: rx, tx (restart), restart event");
+    CHECK(reply_word(5) == 1 && reply_word(7) == 1, "08/01 clears the counters");
+
+    const uint8_t clear[] = {1, 8, 0, 0x0A, 0, 0};
+    request(ctx, fc03, sizeof(fc03));
+    n = request(ctx, clear, sizeof(clear));
+    CHECK(n == 8 && !memcmp(reply, clear, sizeof(clear)), "08/0A echo");
+    CHECK(diag_counter(ctx, 0x0E) == 1 && diag_counter(ctx, 0x0B) == 2, "08/0A clears the counters");
+
+    request(ctx, fc12, sizeof(fc12));
+    CHECK(reply[2] > 6 + 4, "08/0A keeps the log");
+
+    // A reply that cannot be sent counts as no response
+    Modbus_Conf_t *conf = &mbus_context(ctx)->conf;
+    conf->sendbuf_sz = 4;
+    request(ctx, fc03, sizeof(fc03));
+    conf->sendbuf_sz = sizeof(tx_buffer);
+    CHECK(diag_counter(ctx, 0x0F) == 1, "08/0F counts unanswered requests");
+}
+
+int main(void)
+{
+    Modbus_Conf_t conf;
+    mbus_t ctx;
+
+    ctx = open_device(&conf);
+    test_counters(ctx);
+    mbus_close(ctx);
+
+    // Fresh context: exceptions first, then the event log they leave behind
+    ctx = open_device(&conf);
+    test_exceptions(ctx);
+    test_event_log(ctx);
+    test_restart_and_clear(ctx);
+    mbus_close(ctx);
+
+    return TEST_RESULT();
+}
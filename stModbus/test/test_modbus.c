@@ -0,0 +1,251 @@
+/**
+ * @file    test_modbus.c
+ * @brief   Host test of the stModbus engine: requests in, replies out
+ *
+ * Frames go through the host port's frame queue into mbus_poll_frame(), as
+ * the FreeRTOS build feeds them from its communication task. The device is
+ * 200 holding registers, 200 input registers (value 1000 + offset), 16
+ * coils and FC20 file records whose value is file * 100 + record.
+ */
+
+#include "modbus.h"
+#include "test.h"
+#include <string.h>
+
+/* Private variables */
+static uint16_t holding[200];
+static uint8_t coils[16];
+static uint8_t tx_buffer[STMODBUS_MAX_FRAME_SIZE];
+static uint8_t rx_frame[STMODBUS_MAX_FRAME_SIZE];
+static uint8_t reply[STMODBUS_MAX_FRAME_SIZE];
+static int reply_size;
+
+/* Private functions */
+
+static uint16_t dev_read(uint32_t la)
+{
+    if (la >= 40001 && la < 40201)
+        return holding[la - 40001];
+    if (la >= 30001 && la < 30201)
+        return 1000 + (la - 30001);
+    if (la >= 1 && la <= 16)
+        return coils[la - 1];
+    mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+    return 0;
+}
+
+static uint16_t dev_write(uint32_t la, uint16_t value)
+{
+    if (la >= 40001 && la < 40201)
+    {
+        holding[la - 40001] = value;
+        return value;
+    }
+    if (la >= 1 && la <= 16)
+    {
+        coils[la - 1] = value ? 1 : 0;
+        return value;
+    }
+    mbus_error(MBUS_RESPONSE_ILLEGAL_DATA_ADDRESS);
+    return 0;
+}
+
+// Alternating bits for any address, for reads larger than the coil table
+static uint16_t dev_read_pattern(uint32_t la)
+{
+    return la & 1;
+}
+
+static uint16_t dev_read_file(uint16_t file, uint16_t record)
+{
+    return file * 100 + record;
+}
+
+static int dev_send(const mbus_t context, const uint8_t *data, uint16_t size)
+{
+    memcpy(reply, data, size);
+    reply_size = size;
+    return size;
+}
+
+static uint16_t frame_crc(const uint8_t *data, int size)
+{
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < size; i++)
+        crc = mbus_crc16(crc, data[i]);
+    return crc;
+}
+
+// Append the CRC, pass the frame through the port queue, return the reply size
+static int request(mbus_t ctx, const uint8_t *pdu, int size)
+{
+    uint8_t frame[STMODBUS_MAX_FRAME_SIZE];
+    uint16_t crc;
+
+    memcpy(frame, pdu, size);
+    crc = frame_crc(frame, size);
+    frame[size] = crc & 0xFF;
+    frame[size + 1] = crc >> 8;
+
+    reply_size = 0;
+    mbport_queue_put_from_isr(frame, size + 2);
+    uint16_t n = mbport_queue_get(rx_frame, sizeof(rx_frame), 0);
+    mbus_poll_frame(ctx, rx_frame, n);
+    return reply_size;
+}
+
+static void conf_defaults(Modbus_Conf_t *conf)
+{
+    memset(conf, 0, sizeof(*conf));
+    conf->devaddr = 1;
+    conf->coils = 16;
+    conf->send = dev_send;
+    conf->read = dev_read;
+    conf->write = dev_write;
+    conf->read_file = dev_read_file;
+    conf->sendbuf = tx_buffer;
+    conf->sendbuf_sz = sizeof(tx_buffer);
+    conf->recvbuf = rx_frame;
+    conf->recvbuf_sz = sizeof(rx_frame);
+}
+
+/* Tests */
+
+static void test_registers(mbus_t ctx)
+{
+    int n;
+
+    for (int i = 0; i < 200; i++)
+        holding[i] = i;
+
+    const uint8_t fc03[] = {1, 3, 0, 2, 0, 3};
+    n = request(ctx, fc03, sizeof(fc03));
+    CHECK(n == 11 && reply[2] == 6 && reply[3] == 0 && reply[4] == 2 && reply[8] == 4, "FC03 3 registers");
+    CHECK(frame_crc(reply, n) == 0, "FC03 reply CRC");
+
+    const uint8_t fc03_max[] = {1, 3, 0, 0, 0, 125};
+    n = request(ctx, fc03_max, sizeof(fc03_max));
+    CHECK(n == 5 + 250 && reply[2] == 250, "FC03 125 registers");
+
+    const uint8_t fc03_over[] = {1, 3, 0, 0, 0, 126};
+    n = request(ctx, fc03_over, sizeof(fc03_over));
+    CHECK(n == 5 && reply[1] == 0x83 && reply[2] == 3, "FC03 126 registers -> exception 3");
+
+    const uint8_t fc03_zero[] = {1, 3, 0, 0, 0, 0};
+    n = request(ctx, fc03_zero, sizeof(fc03_zero));
+    CHECK(n == 5 && reply[1] == 0x83 && reply[2] == 3, "FC03 0 registers -> exception 3");
+
+    const uint8_t fc04[] = {1, 4, 0, 1, 0, 2};
+    n = request(ctx, fc04, sizeof(fc04));
+    CHECK(n == 9 && reply[3] == (1001 >> 8) && reply[4] == (1001 & 0xFF), "FC04");
+
+    const uint8_t fc06[] = {1, 6, 0, 5, 0x12, 0x34};
+    n = request(ctx, fc06, sizeof(fc06));
+    CHECK(n == 8 && holding[5] == 0x1234 && !memcmp(reply, fc06, sizeof(fc06)), "FC06 echo");
+
+    const uint8_t fc16[] = {1, 16, 0, 10, 0, 2, 4, 0xAB, 0xCD, 0x01, 0x02};
+    n = request(ctx, fc16, sizeof(fc16));
+    CHECK(n == 8 && holding[10] == 0xABCD && holding[11] == 0x0102, "FC16 big-endian values");
+
+    const uint8_t fc16_count[] = {1, 16, 0, 10, 0, 2, 3, 0xAB, 0xCD, 0x01};
+    n = request(ctx, fc16_count, sizeof(fc16_count));
+    CHECK(n == 5 && reply[1] == 0x90 && reply[2] == 3, "FC16 byte count mismatch -> exception 3");
+}
+
+static void test_coils(mbus_t ctx)
+{
+    int n;
+
+    const uint8_t fc05[] = {1, 5, 0, 2, 0xFF, 0};
+    n = request(ctx, fc05, sizeof(fc05));
+    CHECK(n == 8 && coils[2] == 1, "FC05");
+
+    const uint8_t fc01[] = {1, 1, 0, 0, 0, 8};
+    n = request(ctx, fc01, sizeof(fc01));
+    CHECK(n == 6 && reply[3] == 0x04, "FC01 bit packing");
+
+    const uint8_t fc01_range[] = {1, 1, 0, 10, 0, 8};
+    n = request(ctx, fc01_range, sizeof(fc01_range));
+    CHECK(n == 5 && reply[2] == 2, "FC01 out of range -> exception 2");
+}
+
+static void test_framing(mbus_t ctx)
+{
+    int n;
+
+    const uint8_t fc20[] = {1, 20, 7, 6, 0, 3, 0, 5, 0, 2};
+    n = request(ctx, fc20, sizeof(fc20));
+    CHECK(n == 11 && reply[1] == 20 && reply[5] == 0x01 && reply[6] == 0x31, "FC20 file 3 record 5");
+
+    const uint8_t unknown[] = {1, 0x2B, 0, 0};
+    n = request(ctx, unknown, sizeof(unknown));
+    CHECK(n == 0, "unknown function ignored");
+
+    const uint8_t other[] = {2, 3, 0, 0, 0, 1};
+    n = request(ctx, other, sizeof(other));
+    CHECK(n == 0, "other address ignored");
+
+    const uint8_t bad_crc[] = {1, 3, 0, 0, 0, 1, 0, 0};
+    reply_size = 0;
+    mbus_poll_frame(ctx, bad_crc, sizeof(bad_crc));
+    CHECK(reply_size == 0, "bad CRC ignored");
+
+    const uint8_t fc15_big[] = {1, 15, 0, 0, 0xFF, 0xFF};
+    const uint8_t fc03[] = {1, 3, 0, 2, 0, 3};
+    mbus_poll_frame(ctx, fc15_big, sizeof(fc15_big));
+    n = request(ctx, fc03, sizeof(fc03));
+    CHECK(n == 11, "oversized FC15 rejected, parser recovers");
+}
+
+// FC01/FC02 pack up to 2000 bits; the reply must fit the send buffer
+static void test_bit_reply_size(void)
+{
+    Modbus_Conf_t conf;
+    int n;
+
+    conf_defaults(&conf);
+    conf.coils = 2000;
+    conf.sendbuf_sz = 64;
+    conf.read = dev_read_pattern;
+    mbus_t ctx = mbus_open(&conf);
+
+    // 59 data bytes: 3 + 59 + 2 = 64
+    const uint8_t fits[] = {1, 1, 0, 0, 0x01, 0xD8};
+    n = request(ctx, fits, sizeof(fits));
+    CHECK(n == 64 && reply[2] == 59, "FC01 472 coils fill a 64-byte buffer");
+
+    const uint8_t over[] = {1, 1, 0, 0, 0x01, 0xD9};
+    n = request(ctx, over, sizeof(over));
+    CHECK(n == 5 && reply[1] == 0x81 && reply[2] == 4, "FC01 473 coils -> exception 4");
+
+    mbus_close(ctx);
+
+    conf.sendbuf_sz = sizeof(tx_buffer);
+    ctx = mbus_open(&conf);
+    const uint8_t all[] = {1, 1, 0, 0, 0x07, 0xD0};
+    n = request(ctx, all, sizeof(all));
+    CHECK(n == 255 && reply[2] == 250, "FC01 2000 coils in a 256-byte buffer");
+    mbus_close(ctx);
+}
+
+int main(void)
+{
+    Modbus_Conf_t conf;
+
+    conf_defaults(&conf);
+    mbport_queue_init();
+    mbus_t ctx = mbus_open(&conf);
+    CHECK(ctx == 0, "open");
+
+    test_registers(ctx);
+    test_coils(ctx);
+    test_framing(ctx);
+
+    mbus_flush(ctx);
+    mbus_close(ctx);
+    CHECK(mbus_context(ctx) == 0, "close");
+
+    test_bit_reply_size();
+
+    return TEST_RESULT();
+}
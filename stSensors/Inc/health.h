@@ -0,0 +1,82 @@
+/**
+ * @file    health.h
+ * @brief   Per-sensor health, staleness and error counters
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ */
+
+#ifndef __HEALTH_H
+#define __HEALTH_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define HEALTH_MQ2_STALE_MS 5000 // MQ2 is scanned every second
+#define HEALTH_VALUE_COUNT 15    // Quality mirror of 40001-40015
+
+/* Exported types ------------------------------------------------------------*/
+/* Monitored sensors, in Modbus order */
+typedef enum
+{
+    HEALTH_SCD30 = 0,
+    HEALTH_MQ2_CH0, // CH1-CH3 follow
+    HEALTH_SENSOR_COUNT = HEALTH_MQ2_CH0 + 4
+} Health_Sensor_t;
+
+/* Error classes, counted separately */
+typedef enum
+{
+    HEALTH_ERR_NACK = 0, // I2C address/data not acknowledged; ADC start refused (MQ2)
+    HEALTH_ERR_TIMEOUT,  // Bus or conversion timeout
+    HEALTH_ERR_CRC,      // Frame CRC mismatch
+    HEALTH_ERR_RANGE,    // Reading outside the plausible range
+    HEALTH_ERR_COUNT
+} Health_Error_t;
+
+/* Quality code of a sensor and of the values it produces */
+typedef enum
+{
+    HEALTH_QUALITY_GOOD = 0,    // Fresh, valid reading
+    HEALTH_QUALITY_NO_DATA,     // No good reading since boot
+    HEALTH_QUALITY_STALE,       // Last good reading is older than the staleness limit
+    HEALTH_QUALITY_COMM_FAIL,   // Latest attempt failed on the bus (NACK, timeout, CRC)
+    HEALTH_QUALITY_RANGE,       // Latest reading was rejected as implausible
+    HEALTH_QUALITY_INITIALISING // Sensor bring-up still running after boot
+} Health_Quality_t;
+
+/* Registers of one sensor record, in Modbus order */
+typedef enum
+{
+    HEALTH_REG_QUALITY = 0,    // Health_Quality_t
+    HEALTH_REG_LAST_GOOD_HI,   // Uptime of the last good reading (s)
+    HEALTH_REG_LAST_GOOD_LO,
+    HEALTH_REG_AGE,            // Seconds since the last good reading (65535 = never/saturated)
+    HEALTH_REG_CONSEC_FAIL,    // Failed attempts since the last good reading
+    HEALTH_REG_ERR_NACK,       // Totals per error class (wrap)
+    HEALTH_REG_ERR_TIMEOUT,
+    HEALTH_REG_ERR_CRC,
+    HEALTH_REG_ERR_RANGE,
+    HEALTH_REG_COUNT
+} Health_Reg_t;
+
+/* Exported functions --------------------------------------------------------*/
+void Health_Init(void);
+void Health_ReportStarted(Health_Sensor_t sensor);
+void Health_ReportGood(Health_Sensor_t sensor);
+void Health_ReportError(Health_Sensor_t sensor, Health_Error_t error);
+void Health_SetStaleLimit(Health_Sensor_t sensor, uint32_t stale_ms);
+Health_Quality_t Health_GetQuality(Health_Sensor_t sensor);
+uint16_t Health_ReadRegister(Health_Sensor_t sensor, Health_Reg_t reg);
+uint16_t Health_ReadValueQuality(uint8_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HEALTH_H */
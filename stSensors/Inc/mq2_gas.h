@@ -0,0 +1,99 @@
+/**
+ * @file    mq2_gas.h
+ * @brief   MQ2 gas concentration (ppm) estimation from sensor resistance
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ */
+
+#ifndef __MQ2_GAS_H
+#define __MQ2_GAS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "sensors.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/* MQ2 module load-resistor divider: AOUT = Vc * RL / (Rs + RL) */
+#define MQ2_VC_MV 5000    // Heater/circuit supply of the MQ2 module (mV)
+#define MQ2_RL_OHMS 1000  // Load resistor on the MQ2 module (FC-22: 1 kOhm)
+#define MQ2_RS_MAX_OHMS 1000000 // Reported when AOUT reads 0 mV (open/no heater)
+
+/* R0 calibration in clean air (datasheet: Rs/R0 = 9.83 in clean air) */
+#define MQ2_CLEAN_AIR_RATIO_X100 983
+#define MQ2_DEFAULT_R0_OHMS 10000 // Used until calibrated or written over Modbus
+#define MQ2_R0_CAL_SAMPLES 16     // Rs samples averaged per calibration
+
+/* Heater warm-up and baseline tracking (MQ2_Gas_Update runs once per second) */
+#define MQ2_COLD_MV 20                  // AOUT below this: heater off / sensor unplugged
+#define MQ2_WARMUP_MIN_MS (180UL * 1000) // Minimum burn-in before a channel can be ready
+#define MQ2_WARMUP_MAX_MS (900UL * 1000) // Declare ready anyway if it never settles
+#define MQ2_SETTLE_MV 10                // |AOUT - warm-up baseline| counted as settled
+#define MQ2_SETTLE_SAMPLES 30           // Consecutive settled samples required
+#define MQ2_WARMUP_EMA_SHIFT 3          // Warm-up baseline EMA, alpha = 1/8
+#define MQ2_BASELINE_EMA_SHIFT 9        // Stable baseline EMA, alpha = 1/512 (~8.5 min)
+#define MQ2_BASELINE_GATE_MV 100        // Freeze baseline while |delta| exceeds this (gas event)
+#define MQ2_DRIFT_LIMIT_MV 150          // Baseline moved this far from reference: drifted
+
+/* Temperature/humidity compensation table axes (datasheet Fig. 4, ref. 20 °C / 65 %RH) */
+#define MQ2_COMP_TEMP_POINTS 7 // -10 to 50 °C in 10 °C steps
+#define MQ2_COMP_TEMP_MIN_C100 (-1000)
+#define MQ2_COMP_TEMP_STEP_C100 1000
+#define MQ2_COMP_RH_POINTS 3 // 33, 65, 85 %RH
+
+/* Per-channel heater/baseline state */
+typedef enum
+{
+    MQ2_STATE_COLD = 0, // No valid signal yet
+    MQ2_STATE_WARMING,  // Heater burn-in, readings not trustworthy
+    MQ2_STATE_STABLE,   // Ready; baseline close to its reference
+    MQ2_STATE_DRIFTED   // Ready, but baseline drifted - recalibrate R0
+} MQ2_HeaterState_t;
+
+/* Gases estimated from the datasheet sensitivity curves */
+typedef enum
+{
+    MQ2_GAS_LPG = 0,
+    MQ2_GAS_CH4,
+    MQ2_GAS_SMOKE,
+    MQ2_GAS_COUNT
+} MQ2_Gas_t;
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t rs_ohms[MQ2_NUM_CHANNELS];                // Sensor resistance
+    uint32_t r0_ohms[MQ2_NUM_CHANNELS];                // Clean-air reference resistance
+    uint16_t ratio_x100[MQ2_NUM_CHANNELS];             // Rs/R0 x 100
+    uint16_t ppm[MQ2_GAS_COUNT][MQ2_NUM_CHANNELS];     // Estimated concentration per gas
+    uint8_t state[MQ2_NUM_CHANNELS];                   // MQ2_HeaterState_t
+    uint16_t baseline_mv[MQ2_NUM_CHANNELS];            // Slow EMA of AOUT in clean air
+    int16_t delta_mv[MQ2_NUM_CHANNELS];                // AOUT - baseline
+    uint8_t ready_mask;                                // Bit n: channel n warmed up
+    uint8_t drift_mask;                                // Bit n: channel n drifted
+    volatile uint8_t cal_pending;                      // Bit n: calibrate R0 of channel n
+    uint16_t ratio_comp_x100[MQ2_NUM_CHANNELS];        // Rs/R0 x 100, temperature/humidity corrected
+    uint16_t ppm_comp[MQ2_GAS_COUNT][MQ2_NUM_CHANNELS]; // ppm from the corrected Rs/R0
+    uint16_t comp_factor_x1000;                        // Applied correction factor (1000 = none)
+    uint8_t comp_active;                               // 1 = fresh SCD30 data in use
+} MQ2_GasData_t;
+
+/* Exported variables --------------------------------------------------------*/
+extern MQ2_GasData_t mq2_gas;
+
+/* Exported functions --------------------------------------------------------*/
+void MQ2_Gas_Init(void);
+void MQ2_Gas_Update(uint8_t channel, uint16_t voltage_mv);
+void MQ2_Gas_RequestCalibration(uint8_t channel_mask);
+HAL_StatusTypeDef MQ2_Gas_SetR0(uint8_t channel, uint32_t r0_ohms);
+void MQ2_Gas_SetEnvironment(int16_t temp_c100, uint16_t rh_x100, uint32_t valid_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MQ2_GAS_H */
@@ -0,0 +1,26 @@
+/**
+ * @file    scd30_crc.h
+ * @brief   SCD30 CRC-8 (Sensirion: polynomial 0x31, init 0xFF), table driven
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ */
+
+#ifndef __SCD30_CRC_H
+#define __SCD30_CRC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported functions --------------------------------------------------------*/
+    uint8_t SCD30_CalcCRC(const uint8_t *data, uint8_t len);
+    uint8_t SCD30_CheckFrameCRC(const uint8_t *frame, uint8_t words);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCD30_CRC_H */
@@ -0,0 +1,172 @@
+/**
+ * @file    sensors.h
+ * @brief   Unified sensor interface for MQ2 gas sensors and SCD30 environmental sensor
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ */
+
+#ifndef __SENSORS_H
+#define __SENSORS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "scd30_crc.h"
+#include "sensors_conf.h"
+#include <stdint.h>
+
+/* Build hooks, overridden in the project's sensors_conf.h -------------------*/
+#ifndef SENSORS_USE_BURST
+#define SENSORS_USE_BURST 0 // 1 = MQ2 burst capture (mq2_burst.c) shares the ADC scan
+#endif
+#ifndef SENSORS_TRACE_I2C_START
+#define SENSORS_TRACE_I2C_START(arg) ((void)0) // SCD30 transfer started; bytes, bit 15 = read
+#endif
+#ifndef SENSORS_TRACE_I2C_END
+#define SENSORS_TRACE_I2C_END(res) ((void)0) // SCD30 transfer finished; HAL status
+#endif
+#ifndef SENSORS_TRACE_ADC_FRAME
+#define SENSORS_TRACE_ADC_FRAME(burst) ((void)0) // ADC DMA scan complete (interrupt)
+#endif
+#ifndef SENSORS_ON_MQ2_STARTED
+#define SENSORS_ON_MQ2_STARTED() ((void)0) // End of Sensors_StartMQ2()
+#endif
+#ifndef SENSORS_ON_SCD30_STARTED
+#define SENSORS_ON_SCD30_STARTED() ((void)0) // End of Sensors_StartSCD30()
+#endif
+#ifndef SENSORS_ON_SCD30_INTERVAL
+#define SENSORS_ON_SCD30_INTERVAL(seconds) ((void)0) // Measurement interval read or set
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define MQ2_NUM_CHANNELS 4         // 4 MQ2 sensors on ADC channels 0-3
+#define SCD30_I2C_ADDR (0x61 << 1) // SCD30 I2C address (8-bit for HAL)
+#define SCD30_STARTUP_MS 1000      // SCD30 power-up time before the first command (from reset)
+
+/* ADC channel mapping for MQ2 sensors */
+#define MQ2_CH0_CHANNEL ADC_CHANNEL_1 // PA0 -> ADC1_IN1
+#define MQ2_CH1_CHANNEL ADC_CHANNEL_2 // PA1 -> ADC1_IN2
+#define MQ2_CH2_CHANNEL ADC_CHANNEL_3 // PA2 -> ADC1_IN3
+#define MQ2_CH3_CHANNEL ADC_CHANNEL_4 // PA3 -> ADC1_IN4
+
+/* ADC1 scan sequence: MQ2 CH0-CH3 at ranks 1-4, then the internal channels */
+#define ADC_SCAN_LENGTH 6
+#define ADC_SCAN_VREFINT_IDX 4 // Rank 5: internal reference (Vdda measurement)
+#define ADC_SCAN_TEMP_IDX 5    // Rank 6: internal temperature sensor
+#define ADC_FULL_SCALE 4095
+#define ADC_NOMINAL_VDDA_MV 3300 // Used until the first VREFINT reading
+
+/* GPIO pins for MQ2 digital outputs (DOUT) */
+#define MQ2_CH0_DOUT_GPIO GPIOA
+#define MQ2_CH0_DOUT_PIN GPIO_PIN_4 // PA4 -> MQ2 CH0 DOUT
+#define MQ2_CH1_DOUT_GPIO GPIOA
+#define MQ2_CH1_DOUT_PIN GPIO_PIN_5 // PA5 -> MQ2 CH1 DOUT
+#define MQ2_CH2_DOUT_GPIO GPIOA
+#define MQ2_CH2_DOUT_PIN GPIO_PIN_6 // PA6 -> MQ2 CH2 DOUT
+#define MQ2_CH3_DOUT_GPIO GPIOA
+#define MQ2_CH3_DOUT_PIN GPIO_PIN_7 // PA7 -> MQ2 CH3 DOUT
+
+/* SCD30 command constants */
+#define SCD30_CMD_START_MEASUREMENT 0x0010
+#define SCD30_CMD_READ_MEASUREMENT 0x0300
+#define SCD30_CMD_GET_DATA_READY 0x0202
+#define SCD30_CMD_SET_INTERVAL 0x4600
+#define SCD30_CMD_SET_ASC 0x5306
+#define SCD30_CMD_SET_FRC 0x5204
+#define SCD30_CMD_SET_TEMP_OFFSET 0x5403
+#define SCD30_CMD_SET_ALTITUDE 0x5102
+
+/* SCD30 RDY output (high while a new measurement is available) */
+#define SCD30_USE_RDY_PIN 1             // 1 = wait for RDY edge, 0 = always poll 0x0202
+#define SCD30_RDY_GPIO GPIOB
+#define SCD30_RDY_PIN GPIO_PIN_0        // PB0 -> SCD30 RDY (EXTI0)
+#define SCD30_RDY_EXTI_IRQn EXTI0_IRQn
+#define SCD30_RDY_TIMEOUT_MS 5000       // No RDY edge for this long -> fall back to polling
+
+    /* Exported types ------------------------------------------------------------*/
+
+    /* SCD30 configuration items (order = holding register order 40101-40106) */
+    typedef enum
+    {
+        SCD30_CFG_INTERVAL = 0, // Measurement interval (2-1800 s)
+        SCD30_CFG_PRESSURE,     // Ambient pressure compensation (0=off, 700-1400 mbar)
+        SCD30_CFG_ALTITUDE,     // Altitude compensation (m above sea level)
+        SCD30_CFG_TEMP_OFFSET,  // Temperature offset (°C x 100)
+        SCD30_CFG_ASC,          // Automatic self-calibration (1=on, 0=off)
+        SCD30_CFG_FRC,          // Forced recalibration reference (400-2000 ppm)
+        SCD30_CFG_COUNT
+    } SCD30_ConfigItem_t;
+
+    typedef struct
+    {
+        uint16_t value[SCD30_CFG_COUNT]; // Requested/active setting per item
+        volatile uint16_t pending;       // Bit per item: written over Modbus, not yet sent
+        uint16_t errors;                 // Bit per item: last attempt to send failed
+    } SCD30_Config_t;
+
+    typedef struct
+    {
+        uint16_t mq2_values[MQ2_NUM_CHANNELS];   // Raw ADC values (0-4095)
+        uint16_t mq2_voltages[MQ2_NUM_CHANNELS]; // Voltage in millivolts (Vdda compensated)
+        uint8_t mq2_digital[MQ2_NUM_CHANNELS];   // Digital gas detection (1=gas detected, 0=no gas)
+        float scd30_co2;                         // CO2 concentration in ppm
+        float scd30_temperature;                 // Temperature in Celsius
+        float scd30_humidity;                    // Relative humidity in %
+        uint8_t scd30_data_ready;                // SCD30 data ready flag
+        uint8_t scd30_rdy_mode;                  // 1 = RDY pin interrupt, 0 = data-ready polling
+        uint32_t scd30_i2c_transactions;         // I2C transfers issued to the SCD30
+        uint32_t scd30_samples;                  // Measurements read successfully
+        uint16_t vdda_mv;                        // Analog supply measured via VREFINT (mV)
+        int16_t mcu_temp_c100;                   // MCU die temperature (°C x 100)
+        uint32_t last_update;                    // Timestamp of last sensor update
+    } SensorData_t;
+
+    /* Exported variables --------------------------------------------------------*/
+    extern SensorData_t sensor_data;
+    extern SCD30_Config_t scd30_config;
+
+    /* Exported function prototypes ----------------------------------------------*/
+
+    /* MQ2 Gas Sensor Functions */
+    HAL_StatusTypeDef MQ2_Init(void);
+    HAL_StatusTypeDef MQ2_ReadChannel(uint8_t channel, uint16_t *adc_value, uint16_t *voltage_mv);
+    HAL_StatusTypeDef MQ2_StartScan(void);
+    HAL_StatusTypeDef MQ2_ReadDigitalChannel(uint8_t channel, uint8_t *gas_detected);
+    HAL_StatusTypeDef MQ2_ReadAllChannels(void);
+
+    /* SCD30 Environmental Sensor Functions */
+    HAL_StatusTypeDef SCD30_Init(void);
+    HAL_StatusTypeDef SCD30_StartMeasurement(void);
+    HAL_StatusTypeDef SCD30_DataReady(uint8_t *ready);
+    HAL_StatusTypeDef SCD30_ReadMeasurement(float *co2, float *temperature, float *humidity);
+    HAL_StatusTypeDef SCD30_UpdateData(void);
+    HAL_StatusTypeDef SCD30_RequestConfig(SCD30_ConfigItem_t item, uint16_t value);
+    void SCD30_ApplyPendingConfig(void);
+    void SCD30_RdyCallback(void);
+    void SCD30_WaitForData(uint32_t timeout_ms);
+    uint8_t SCD30_RdyPending(void);
+    uint16_t SCD30_GetTransactionsPerSample(void);
+
+    /* Unified Sensor Interface */
+    void Sensors_Init(void);
+    HAL_StatusTypeDef Sensors_StartMQ2(void);
+    HAL_StatusTypeDef Sensors_StartSCD30(void);
+    uint8_t Sensors_InitStep(void);
+    void Sensors_UpdateAll(void);
+    void Sensors_UpdateMQ2(void);
+    void Sensors_UpdateSCD30(void);
+    uint16_t Sensors_GetMQ2Value(uint8_t channel);
+    uint16_t Sensors_GetMQ2Voltage(uint8_t channel);
+    uint8_t Sensors_GetMQ2Digital(uint8_t channel);
+    float Sensors_GetSCD30_CO2(void);
+    float Sensors_GetSCD30_Temperature(void);
+    float Sensors_GetSCD30_Humidity(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SENSORS_H */
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ * @file    snport.h
+ * @brief   stSensors port layer: what the sensor stack needs from the OS
+ *
+ * The sensor drivers (sensors.c), the gas model (mq2_gas.c) and the health
+ * records (health.c) are shared by every build. What depends on how the
+ * firmware runs lives behind this interface, and a build links exactly one
+ * implementation from stSensors/port/:
+ *
+ *   baremetal/  main loop + interrupts (PRIMASK, spin on the HAL tick)
+ *   freertos/   FreeRTOS tasks (kernel critical sections, thread flags)
+ *
+ * Both waits follow the same pattern: the waiter calls *_begin() before the
+ * event can happen, the interrupt calls *_from_isr(), and *_wait() returns
+ * once the event was signalled or the timeout ran out. Waits belong to the
+ * main loop or a task: called from an interrupt they fail at once.
+ */
+
+#ifndef _STSENSORS_PORT_H_
+#define _STSENSORS_PORT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Critical sections: Modbus context against the sensor updates (nest freely) */
+    void snport_enter_critical(void);
+    void snport_exit_critical(void);
+
+    /* ADC scan: begin before starting the DMA, done from its interrupt */
+    void snport_scan_begin(void);
+    void snport_scan_done_from_isr(void);
+    uint8_t snport_scan_wait(uint32_t timeout_ms);
+
+    /* SCD30 RDY edge: begin before checking for a measurement, edge from EXTI */
+    void snport_rdy_begin(void);
+    void snport_rdy_from_isr(void);
+    void snport_rdy_wait(uint32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STSENSORS_PORT_H_
@@ -0,0 +1,180 @@
+/**
+ * @file    health.c
+ * @brief   Per-sensor health, staleness and error counters
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ *
+ * The sensor drivers report every good reading and every failed bus
+ * transfer, CRC mismatch or rejected value from the paths they already run,
+ * so health tracking adds no bus traffic. Age and quality are computed
+ * when read, which lets a master tell a stale sensor from a value of zero.
+ * Until its bring-up has finished a sensor reads as "initialising"; the
+ * flag is clear in .bss, so this holds even before Health_Init() runs.
+ */
+
+#include "health.h"
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t last_good;    // Tick of the last good reading
+    uint32_t stale_ms;     // Age beyond which the sensor counts as stale
+    uint16_t consec_fail;  // Failures since the last good reading
+    uint16_t errors[HEALTH_ERR_COUNT];
+    uint8_t ever_good;     // At least one good reading since boot
+    uint8_t last_error;    // Health_Error_t of the latest failure
+    uint8_t started;       // Bring-up finished (successfully or not)
+} Health_Record_t;
+
+/* Private variables ---------------------------------------------------------*/
+static Health_Record_t health[HEALTH_SENSOR_COUNT];
+
+// Sensor behind each of 40001-40015: MQ2 raw, mV and digital per channel, then SCD30
+static const uint8_t health_value_sensor[HEALTH_VALUE_COUNT] = {
+    HEALTH_MQ2_CH0, HEALTH_MQ2_CH0 + 1, HEALTH_MQ2_CH0 + 2, HEALTH_MQ2_CH0 + 3,
+    HEALTH_MQ2_CH0, HEALTH_MQ2_CH0 + 1, HEALTH_MQ2_CH0 + 2, HEALTH_MQ2_CH0 + 3,
+    HEALTH_MQ2_CH0, HEALTH_MQ2_CH0 + 1, HEALTH_MQ2_CH0 + 2, HEALTH_MQ2_CH0 + 3,
+    HEALTH_SCD30, HEALTH_SCD30, HEALTH_SCD30};
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Clear all records (every sensor starts as "no data")
+ * @param  None
+ * @retval None
+ */
+void Health_Init(void)
+{
+    memset(health, 0, sizeof(health));
+    for (uint8_t i = 0; i < HEALTH_SENSOR_COUNT; i++)
+    {
+        health[i].stale_ms = HEALTH_MQ2_STALE_MS;
+    }
+}
+
+/**
+ * @brief  Record that a sensor's bring-up has finished
+ * @param  sensor: Sensor
+ * @retval None
+ * @note   A failed bring-up is reported with Health_ReportError() after this.
+ */
+void Health_ReportStarted(Health_Sensor_t sensor)
+{
+    if (sensor < HEALTH_SENSOR_COUNT)
+        health[sensor].started = 1;
+}
+
+/**
+ * @brief  Record a good reading
+ * @param  sensor: Sensor
+ * @retval None
+ */
+void Health_ReportGood(Health_Sensor_t sensor)
+{
+    if (sensor >= HEALTH_SENSOR_COUNT)
+        return;
+
+    health[sensor].last_good = HAL_GetTick();
+    health[sensor].consec_fail = 0;
+    health[sensor].ever_good = 1;
+}
+
+/**
+ * @brief  Record a failed attempt
+ * @param  sensor: Sensor
+ * @param  error: Error class
+ * @retval None
+ */
+void Health_ReportError(Health_Sensor_t sensor, Health_Error_t error)
+{
+    if (sensor >= HEALTH_SENSOR_COUNT || error >= HEALTH_ERR_COUNT)
+        return;
+
+    health[sensor].errors[error]++;
+    if (health[sensor].consec_fail < 0xFFFF)
+        health[sensor].consec_fail++;
+    health[sensor].last_error = error;
+}
+
+/**
+ * @brief  Set how old the last good reading may get before it is stale
+ * @param  sensor: Sensor
+ * @param  stale_ms: Staleness limit (ms)
+ * @retval None
+ */
+void Health_SetStaleLimit(Health_Sensor_t sensor, uint32_t stale_ms)
+{
+    if (sensor < HEALTH_SENSOR_COUNT)
+        health[sensor].stale_ms = stale_ms;
+}
+
+/**
+ * @brief  Current quality of a sensor
+ * @param  sensor: Sensor
+ * @retval Health_Quality_t, failures take precedence over staleness
+ */
+Health_Quality_t Health_GetQuality(Health_Sensor_t sensor)
+{
+    if (sensor >= HEALTH_SENSOR_COUNT)
+        return HEALTH_QUALITY_NO_DATA;
+
+    const Health_Record_t *h = &health[sensor];
+
+    if (!h->started)
+        return HEALTH_QUALITY_INITIALISING;
+    if (h->consec_fail > 0)
+        return (h->last_error == HEALTH_ERR_RANGE) ? HEALTH_QUALITY_RANGE : HEALTH_QUALITY_COMM_FAIL;
+    if (!h->ever_good)
+        return HEALTH_QUALITY_NO_DATA;
+    if ((HAL_GetTick() - h->last_good) > h->stale_ms)
+        return HEALTH_QUALITY_STALE;
+    return HEALTH_QUALITY_GOOD;
+}
+
+/**
+ * @brief  Read one register of a sensor record (Modbus context)
+ * @param  sensor: Sensor
+ * @param  reg: Register within the record
+ * @retval Register value
+ */
+uint16_t Health_ReadRegister(Health_Sensor_t sensor, Health_Reg_t reg)
+{
+    if (sensor >= HEALTH_SENSOR_COUNT)
+        return 0;
+
+    const Health_Record_t *h = &health[sensor];
+    uint32_t age_s = (HAL_GetTick() - h->last_good) / 1000;
+
+    switch (reg)
+    {
+    case HEALTH_REG_QUALITY:
+        return Health_GetQuality(sensor);
+    case HEALTH_REG_LAST_GOOD_HI:
+        return (uint16_t)((h->last_good / 1000) >> 16);
+    case HEALTH_REG_LAST_GOOD_LO:
+        return (uint16_t)(h->last_good / 1000);
+    case HEALTH_REG_AGE:
+        return (!h->ever_good || age_s > 0xFFFF) ? 0xFFFF : (uint16_t)age_s;
+    case HEALTH_REG_CONSEC_FAIL:
+        return h->consec_fail;
+    case HEALTH_REG_ERR_NACK:
+    case HEALTH_REG_ERR_TIMEOUT:
+    case HEALTH_REG_ERR_CRC:
+    case HEALTH_REG_ERR_RANGE:
+        return h->errors[reg - HEALTH_REG_ERR_NACK];
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief  Quality of one of the mapped values 40001-40015 (Modbus context)
+ * @param  index: Register index (0 = 40001)
+ * @retval Health_Quality_t of the sensor producing the value
+ */
+uint16_t Health_ReadValueQuality(uint8_t index)
+{
+    if (index >= HEALTH_VALUE_COUNT)
+        return HEALTH_QUALITY_NO_DATA;
+    return Health_GetQuality((Health_Sensor_t)health_value_sensor[index]);
+}
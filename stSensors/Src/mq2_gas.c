@@ -0,0 +1,495 @@
+/**
+ * @file    mq2_gas.c
+ * @brief   MQ2 gas concentration (ppm) estimation from sensor resistance
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ *
+ * The MQ2 sensitivity curves are straight-ish lines on a log-log plot, so the
+ * whole estimate is done in the log2 domain with Q16 fixed point:
+ *   log2(Rs/R0) = log2(Rs) - log2(R0)            (no division)
+ *   log2(ppm)   = piecewise-linear LUT(log2(Rs/R0))
+ *   ppm         = 2^log2(ppm)
+ * log2/exp2 are 32-segment table interpolations, so one channel costs a few
+ * hundred cycles and no floating point.
+ *
+ * Each channel also runs a heater state machine:
+ *   COLD -> WARMING -> STABLE <-> DRIFTED
+ * WARMING lasts at least MQ2_WARMUP_MIN_MS and until AOUT has settled on its
+ * baseline; ppm reads 0 and R0 calibration waits until the channel is ready.
+ *
+ * Temperature/humidity compensation divides Rs/R0 by the datasheet factor
+ * f(T, RH) - a subtraction of log2(f) in this domain. f is bilinearly
+ * interpolated once per new SCD30 sample and reused by every MQ2 update.
+ */
+
+#include "mq2_gas.h"
+#include "snport.h"
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+    int32_t log2_ratio; // log2(Rs/R0), Q16
+    int32_t log2_ppm;   // log2(ppm), Q16
+} MQ2_CurvePoint_t;
+
+/* Private defines -----------------------------------------------------------*/
+#define MQ2_CURVE_POINTS 6
+
+/* Private variables ---------------------------------------------------------*/
+MQ2_GasData_t mq2_gas = {0};
+
+/* log2(1 + i/32) in Q16, i = 0..32 */
+static const uint32_t log2_table[33] = {
+    0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+    27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904, 47705,
+    49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534, 64047, 65536,
+};
+
+/* 2^(i/32) in Q16, i = 0..32 */
+static const uint32_t exp2_table[33] = {
+    65536, 66971, 68438, 69936, 71468, 73032, 74632, 76266, 77936, 79642, 81386,
+    83169, 84990, 86851, 88752, 90696, 92682, 94711, 96785, 98905, 101070, 103283,
+    105545, 107856, 110218, 112631, 115098, 117618, 120194, 122825, 125515, 128263, 131072,
+};
+
+/* Sensitivity curves (datasheet Fig. 2, 200-10000 ppm), ordered by falling Rs/R0 */
+static const MQ2_CurvePoint_t mq2_curves[MQ2_GAS_COUNT][MQ2_CURVE_POINTS] = {
+    [MQ2_GAS_LPG] = {
+        {47348, 500948},   // Rs/R0 1.65 -> 200 ppm
+        {10715, 587582},   // Rs/R0 1.12 -> 500 ppm
+        {-15366, 653118},  // Rs/R0 0.85 -> 1000 ppm
+        {-45198, 718654},  // Rs/R0 0.62 -> 2000 ppm
+        {-82021, 805288},  // Rs/R0 0.42 -> 5000 ppm
+        {-113834, 870824}, // Rs/R0 0.30 -> 10000 ppm
+    },
+    [MQ2_GAS_CH4] = {
+        {103872, 500948}, // Rs/R0 3.00 -> 200 ppm
+        {74547, 587582},  // Rs/R0 2.20 -> 500 ppm
+        {52911, 653118},  // Rs/R0 1.75 -> 1000 ppm
+        {30452, 718654},  // Rs/R0 1.38 -> 2000 ppm
+        {1872, 805288},   // Rs/R0 1.02 -> 5000 ppm
+        {-21098, 870824}, // Rs/R0 0.80 -> 10000 ppm
+    },
+    [MQ2_GAS_SMOKE] = {
+        {115706, 500948}, // Rs/R0 3.40 -> 200 ppm
+        {78750, 587582},  // Rs/R0 2.30 -> 500 ppm
+        {52911, 653118},  // Rs/R0 1.75 -> 1000 ppm
+        {28374, 718654},  // Rs/R0 1.35 -> 2000 ppm
+        {-4850, 805288},  // Rs/R0 0.95 -> 5000 ppm
+        {-31060, 870824}, // Rs/R0 0.72 -> 10000 ppm
+    },
+};
+
+/* log2 of Rs/R0 relative to 20 °C / 65 %RH, Q16, rows by humidity, columns by temperature */
+static const int32_t mq2_comp_table[MQ2_COMP_RH_POINTS][MQ2_COMP_TEMP_POINTS] = {
+    // -10 C   0 C     10 C    20 C    30 C    40 C    50 C
+    {24806, 15649, 8148, 2795, -2880, -6861, -7884},      // 33 %RH: 1.30 ... 0.92
+    {18801, 9011, 3708, 0, -6861, -11018, -13167},        // 65 %RH: 1.22 ... 0.87
+    {13214, 3708, -3860, -8917, -14260, -18763, -19923},  // 85 %RH: 1.15 ... 0.81
+};
+
+static const uint16_t mq2_comp_rh_x100[MQ2_COMP_RH_POINTS] = {3300, 6500, 8500};
+
+/* Segment slopes d(log2 ppm)/d(-log2 ratio) in Q12, filled by MQ2_Gas_Init */
+static int32_t mq2_slopes_q12[MQ2_GAS_COUNT][MQ2_CURVE_POINTS - 1];
+
+static int32_t log2_r0[MQ2_NUM_CHANNELS];        // log2(R0), Q16
+static int32_t log2_clean_air;                   // log2(MQ2_CLEAN_AIR_RATIO), Q16
+static int32_t log2_hundred;                     // log2(100), Q16
+static int32_t cal_sum[MQ2_NUM_CHANNELS];        // Sum of log2(Rs) during calibration
+static uint8_t cal_count[MQ2_NUM_CHANNELS];      // Samples collected so far
+
+static int32_t baseline_q8[MQ2_NUM_CHANNELS];    // Baseline EMA, mV in Q8
+static int32_t reference_q8[MQ2_NUM_CHANNELS];   // Baseline when the channel became ready
+static uint32_t warm_start[MQ2_NUM_CHANNELS];    // Tick when warm-up began
+static uint8_t settle_count[MQ2_NUM_CHANNELS];   // Consecutive settled samples
+
+static int32_t log2_comp;                        // log2(f(T, RH)), Q16
+static int32_t log2_thousand;                    // log2(1000), Q16
+static uint32_t comp_tick;                       // Tick of the last environment sample
+static uint32_t comp_valid_ms;                   // How long that sample stays usable
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t Log2_Q16(uint32_t x);
+static uint32_t Exp2_Q16(int32_t y);
+static uint16_t MQ2_Gas_Lookup(MQ2_Gas_t gas, int32_t log2_ratio);
+static void MQ2_Gas_Calibrate(uint8_t channel, int32_t log2_rs);
+static void MQ2_Gas_Track(uint8_t channel, uint16_t voltage_mv);
+static uint16_t Q16_ToUint16(int32_t log2_value);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief  Fixed-point base-2 logarithm
+ * @param  x: Input value (> 0)
+ * @retval log2(x) in Q16
+ */
+static int32_t Log2_Q16(uint32_t x)
+{
+    if (x == 0)
+        return 0;
+
+    int32_t msb = 31 - (int32_t)__CLZ(x);
+    uint32_t norm = x << (31 - msb); // 1.xxx with the leading one at bit 31
+
+    uint32_t idx = (norm >> 26) & 0x1F;    // Next 5 bits select the segment
+    uint32_t frac = (norm >> 10) & 0xFFFF; // Following 16 bits interpolate in it
+    int32_t y0 = log2_table[idx];
+    int32_t y1 = log2_table[idx + 1];
+
+    return (msb << 16) + y0 + (int32_t)(((uint32_t)(y1 - y0) * frac) >> 16);
+}
+
+/**
+ * @brief  Fixed-point base-2 exponential
+ * @param  y: Exponent in Q16
+ * @retval 2^y (integer part), 0 for y < 0, saturated at UINT32_MAX
+ */
+static uint32_t Exp2_Q16(int32_t y)
+{
+    if (y < 0)
+        return 0;
+
+    uint32_t ip = (uint32_t)y >> 16;
+    uint32_t fp = (uint32_t)y & 0xFFFF;
+    if (ip > 30)
+        return UINT32_MAX;
+
+    uint32_t idx = fp >> 11;
+    uint32_t frac = (fp & 0x7FF) << 5;
+    uint32_t m = exp2_table[idx] + (((exp2_table[idx + 1] - exp2_table[idx]) * frac) >> 16);
+
+    // m is 2^frac in Q16 (17 bits); shift by the integer part
+    return (ip >= 16) ? (m << (ip - 16)) : (m >> (16 - ip));
+}
+
+/**
+ * @brief  Estimate concentration from the log-log sensitivity curve
+ * @param  gas: Gas curve to use
+ * @param  log2_ratio: log2(Rs/R0) in Q16
+ * @retval ppm (0 below the curve range, clamped at its top)
+ */
+static uint16_t MQ2_Gas_Lookup(MQ2_Gas_t gas, int32_t log2_ratio)
+{
+    const MQ2_CurvePoint_t *curve = mq2_curves[gas];
+
+    // Rs/R0 above the 200 ppm point: below detection range
+    if (log2_ratio > curve[0].log2_ratio)
+        return 0;
+
+    // Rs/R0 below the last point: saturate at the top of the curve
+    if (log2_ratio <= curve[MQ2_CURVE_POINTS - 1].log2_ratio)
+        return (uint16_t)Exp2_Q16(curve[MQ2_CURVE_POINTS - 1].log2_ppm);
+
+    uint8_t i = 0;
+    while (log2_ratio <= curve[i + 1].log2_ratio)
+        i++;
+
+    int32_t log2_ppm = curve[i].log2_ppm +
+                       (((curve[i].log2_ratio - log2_ratio) * mq2_slopes_q12[gas][i]) >> 12);
+
+    uint32_t ppm = Exp2_Q16(log2_ppm);
+    return (ppm > 0xFFFF) ? 0xFFFF : (uint16_t)ppm;
+}
+
+/**
+ * @brief  Convert a log2 value back to a saturated 16-bit integer
+ * @param  log2_value: log2 of the result, Q16
+ * @retval 2^log2_value clamped to 0-65535
+ */
+static uint16_t Q16_ToUint16(int32_t log2_value)
+{
+    uint32_t v = Exp2_Q16(log2_value);
+    return (v > 0xFFFF) ? 0xFFFF : (uint16_t)v;
+}
+
+/**
+ * @brief  Accumulate a clean-air sample and finish R0 calibration
+ * @param  channel: Channel number (0-3)
+ * @param  log2_rs: log2(Rs) in Q16
+ * @retval None
+ * @note   Averaging in the log domain gives the geometric mean of Rs,
+ *         which is less sensitive to single noisy samples.
+ */
+static void MQ2_Gas_Calibrate(uint8_t channel, int32_t log2_rs)
+{
+    cal_sum[channel] += log2_rs;
+    if (++cal_count[channel] < MQ2_R0_CAL_SAMPLES)
+        return;
+
+    // R0 = Rs(clean air) / 9.83
+    log2_r0[channel] = cal_sum[channel] / MQ2_R0_CAL_SAMPLES - log2_clean_air;
+    mq2_gas.r0_ohms[channel] = Exp2_Q16(log2_r0[channel]);
+
+    cal_sum[channel] = 0;
+    cal_count[channel] = 0;
+
+    // The current baseline is the new clean-air reference
+    reference_q8[channel] = baseline_q8[channel];
+
+    snport_enter_critical();
+    mq2_gas.cal_pending &= (uint8_t)~(1U << channel);
+    snport_exit_critical();
+}
+
+/**
+ * @brief  Advance the heater state machine and baseline EMA for one channel
+ * @param  channel: Channel number (0-3)
+ * @param  voltage_mv: MQ2 AOUT voltage in millivolts
+ * @retval None
+ */
+static void MQ2_Gas_Track(uint8_t channel, uint16_t voltage_mv)
+{
+    int32_t x = (int32_t)voltage_mv << 8;
+    int32_t delta = x - baseline_q8[channel];
+    uint32_t now = HAL_GetTick();
+
+    if (voltage_mv < MQ2_COLD_MV)
+    {
+        // Heater unpowered or sensor missing: restart warm-up when it returns
+        mq2_gas.state[channel] = MQ2_STATE_COLD;
+    }
+
+    switch (mq2_gas.state[channel])
+    {
+    case MQ2_STATE_COLD:
+        if (voltage_mv >= MQ2_COLD_MV)
+        {
+            baseline_q8[channel] = x;
+            warm_start[channel] = now;
+            settle_count[channel] = 0;
+            mq2_gas.state[channel] = MQ2_STATE_WARMING;
+        }
+        break;
+
+    case MQ2_STATE_WARMING:
+        baseline_q8[channel] += delta >> MQ2_WARMUP_EMA_SHIFT;
+
+        if (delta > -(MQ2_SETTLE_MV << 8) && delta < (MQ2_SETTLE_MV << 8))
+        {
+            if (settle_count[channel] < 0xFF)
+                settle_count[channel]++;
+        }
+        else
+        {
+            settle_count[channel] = 0;
+        }
+
+        if (((now - warm_start[channel]) >= MQ2_WARMUP_MIN_MS && settle_count[channel] >= MQ2_SETTLE_SAMPLES) ||
+            (now - warm_start[channel]) >= MQ2_WARMUP_MAX_MS)
+        {
+            reference_q8[channel] = baseline_q8[channel];
+            mq2_gas.state[channel] = MQ2_STATE_STABLE;
+        }
+        break;
+
+    case MQ2_STATE_STABLE:
+    case MQ2_STATE_DRIFTED:
+    {
+        // Track slow drift only; a gas event must not pull the baseline up
+        if (delta > -(MQ2_BASELINE_GATE_MV << 8) && delta < (MQ2_BASELINE_GATE_MV << 8))
+            baseline_q8[channel] += delta >> MQ2_BASELINE_EMA_SHIFT;
+
+        int32_t drift = baseline_q8[channel] - reference_q8[channel];
+        if (drift < 0)
+            drift = -drift;
+
+        // Half-limit hysteresis on the way back
+        if (drift > (MQ2_DRIFT_LIMIT_MV << 8))
+            mq2_gas.state[channel] = MQ2_STATE_DRIFTED;
+        else if (drift < (MQ2_DRIFT_LIMIT_MV << 7))
+            mq2_gas.state[channel] = MQ2_STATE_STABLE;
+        break;
+    }
+
+    default:
+        mq2_gas.state[channel] = MQ2_STATE_COLD;
+        break;
+    }
+
+    uint8_t bit = 1U << channel;
+    uint8_t ready = (mq2_gas.state[channel] >= MQ2_STATE_STABLE);
+
+    mq2_gas.baseline_mv[channel] = (uint16_t)((baseline_q8[channel] + 128) >> 8);
+    mq2_gas.delta_mv[channel] = ready ? (int16_t)(voltage_mv - mq2_gas.baseline_mv[channel]) : 0;
+    mq2_gas.ready_mask = ready ? (mq2_gas.ready_mask | bit) : (mq2_gas.ready_mask & ~bit);
+    mq2_gas.drift_mask = (mq2_gas.state[channel] == MQ2_STATE_DRIFTED) ? (mq2_gas.drift_mask | bit)
+                                                                       : (mq2_gas.drift_mask & ~bit);
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief  Initialize the gas estimation engine
+ * @param  None
+ * @retval None
+ */
+void MQ2_Gas_Init(void)
+{
+    memset(&mq2_gas, 0, sizeof(mq2_gas));
+    memset(cal_sum, 0, sizeof(cal_sum));
+    memset(cal_count, 0, sizeof(cal_count));
+    memset(baseline_q8, 0, sizeof(baseline_q8));
+    memset(reference_q8, 0, sizeof(reference_q8));
+
+    log2_clean_air = Log2_Q16(MQ2_CLEAN_AIR_RATIO_X100) - Log2_Q16(100);
+    log2_hundred = Log2_Q16(100);
+    log2_thousand = Log2_Q16(1000);
+    log2_comp = 0;
+    comp_valid_ms = 0;
+    mq2_gas.comp_factor_x1000 = 1000;
+
+    // Precompute segment slopes so an update needs no division
+    for (uint8_t gas = 0; gas < MQ2_GAS_COUNT; gas++)
+    {
+        const MQ2_CurvePoint_t *curve = mq2_curves[gas];
+        for (uint8_t i = 0; i < MQ2_CURVE_POINTS - 1; i++)
+        {
+            mq2_slopes_q12[gas][i] = ((curve[i + 1].log2_ppm - curve[i].log2_ppm) << 12) /
+                                     (curve[i].log2_ratio - curve[i + 1].log2_ratio);
+        }
+    }
+
+    for (uint8_t ch = 0; ch < MQ2_NUM_CHANNELS; ch++)
+    {
+        MQ2_Gas_SetR0(ch, MQ2_DEFAULT_R0_OHMS);
+    }
+}
+
+/**
+ * @brief  Update warm-up state, baseline, Rs, Rs/R0 and ppm for one channel
+ * @param  channel: Channel number (0-3)
+ * @param  voltage_mv: MQ2 AOUT voltage in millivolts
+ * @retval None
+ */
+void MQ2_Gas_Update(uint8_t channel, uint16_t voltage_mv)
+{
+    if (channel >= MQ2_NUM_CHANNELS)
+        return;
+
+    // Rs = RL * (Vc - Vout) / Vout
+    uint32_t rs;
+    if (voltage_mv == 0)
+        rs = MQ2_RS_MAX_OHMS;
+    else if (voltage_mv >= MQ2_VC_MV)
+        rs = 1;
+    else
+        rs = (MQ2_RL_OHMS * (uint32_t)(MQ2_VC_MV - voltage_mv)) / voltage_mv;
+    if (rs == 0)
+        rs = 1;
+    mq2_gas.rs_ohms[channel] = rs;
+
+    int32_t log2_rs = Log2_Q16(rs);
+
+    MQ2_Gas_Track(channel, voltage_mv);
+    uint8_t ready = (mq2_gas.ready_mask & (1U << channel)) != 0;
+
+    // A calibration requested during warm-up starts once the channel is ready
+    if (ready && (mq2_gas.cal_pending & (1U << channel)))
+    {
+        MQ2_Gas_Calibrate(channel, log2_rs);
+    }
+
+    int32_t log2_ratio = log2_rs - log2_r0[channel];
+
+    mq2_gas.ratio_x100[channel] = Q16_ToUint16(log2_ratio + log2_hundred);
+
+    // Temperature/humidity correction; falls back to raw when SCD30 data is stale
+    mq2_gas.comp_active = (comp_valid_ms != 0 && (HAL_GetTick() - comp_tick) <= comp_valid_ms);
+    int32_t log2_ratio_comp = mq2_gas.comp_active ? (log2_ratio - log2_comp) : log2_ratio;
+    mq2_gas.ratio_comp_x100[channel] = Q16_ToUint16(log2_ratio_comp + log2_hundred);
+
+    // Suppress ppm until the heater has burnt in to avoid false alarms
+    for (uint8_t gas = 0; gas < MQ2_GAS_COUNT; gas++)
+    {
+        mq2_gas.ppm[gas][channel] = ready ? MQ2_Gas_Lookup((MQ2_Gas_t)gas, log2_ratio) : 0;
+        mq2_gas.ppm_comp[gas][channel] = ready ? MQ2_Gas_Lookup((MQ2_Gas_t)gas, log2_ratio_comp) : 0;
+    }
+}
+
+/**
+ * @brief  Start clean-air R0 calibration (safe to call from Modbus)
+ * @param  channel_mask: Bit n selects channel n
+ * @retval None
+ */
+void MQ2_Gas_RequestCalibration(uint8_t channel_mask)
+{
+    mq2_gas.cal_pending |= channel_mask & ((1U << MQ2_NUM_CHANNELS) - 1);
+}
+
+/**
+ * @brief  Set R0 directly (e.g. restore a stored calibration)
+ * @param  channel: Channel number (0-3)
+ * @param  r0_ohms: Clean-air resistance in ohms
+ * @retval HAL status
+ */
+HAL_StatusTypeDef MQ2_Gas_SetR0(uint8_t channel, uint32_t r0_ohms)
+{
+    if (channel >= MQ2_NUM_CHANNELS || r0_ohms == 0)
+        return HAL_ERROR;
+
+    mq2_gas.r0_ohms[channel] = r0_ohms;
+    log2_r0[channel] = Log2_Q16(r0_ohms);
+    return HAL_OK;
+}
+
+/**
+ * @brief  Update the compensation factor from a new SCD30 sample
+ * @param  temp_c100: Ambient temperature in °C x 100
+ * @param  rh_x100: Relative humidity in % x 100
+ * @param  valid_ms: How long the sample may be applied before it is stale
+ * @retval None
+ * @note   Bilinear interpolation of log2(f) over the temperature x humidity
+ *         table, clamped at the table edges.
+ */
+void MQ2_Gas_SetEnvironment(int16_t temp_c100, uint16_t rh_x100, uint32_t valid_ms)
+{
+    // Temperature axis is uniform: column index and Q16 fraction directly
+    int32_t t = temp_c100 - MQ2_COMP_TEMP_MIN_C100;
+    int32_t t_max = (MQ2_COMP_TEMP_POINTS - 1) * MQ2_COMP_TEMP_STEP_C100;
+    if (t < 0)
+        t = 0;
+    if (t > t_max)
+        t = t_max;
+    uint8_t ti = (uint8_t)(t / MQ2_COMP_TEMP_STEP_C100);
+    if (ti >= MQ2_COMP_TEMP_POINTS - 1)
+        ti = MQ2_COMP_TEMP_POINTS - 2;
+    int32_t tf = ((t - ti * MQ2_COMP_TEMP_STEP_C100) << 16) / MQ2_COMP_TEMP_STEP_C100;
+
+    // Humidity axis is not uniform: find the row pair
+    uint8_t hi = 0;
+    int32_t hf;
+    if (rh_x100 <= mq2_comp_rh_x100[0])
+    {
+        hf = 0;
+    }
+    else if (rh_x100 >= mq2_comp_rh_x100[MQ2_COMP_RH_POINTS - 1])
+    {
+        hi = MQ2_COMP_RH_POINTS - 2;
+        hf = 1 << 16;
+    }
+    else
+    {
+        while (rh_x100 > mq2_comp_rh_x100[hi + 1])
+            hi++;
+        hf = ((int32_t)(rh_x100 - mq2_comp_rh_x100[hi]) << 16) /
+             (mq2_comp_rh_x100[hi + 1] - mq2_comp_rh_x100[hi]);
+    }
+
+    // Interpolate along temperature on both rows, then between the rows.
+    // Table values stay below 2^15, so the Q16 products fit in 32 bits.
+    const int32_t *r0 = mq2_comp_table[hi];
+    const int32_t *r1 = mq2_comp_table[hi + 1];
+    int32_t a = r0[ti] + (((r0[ti + 1] - r0[ti]) * tf) >> 16);
+    int32_t b = r1[ti] + (((r1[ti + 1] - r1[ti]) * tf) >> 16);
+
+    int32_t comp = a + (((b - a) * hf) >> 16);
+
+    // An MQ2 update running in another task must not see the factor half-updated
+    snport_enter_critical();
+    log2_comp = comp;
+    comp_tick = HAL_GetTick();
+    comp_valid_ms = valid_ms;
+    mq2_gas.comp_factor_x1000 = Q16_ToUint16(comp + log2_thousand);
+    snport_exit_critical();
+}
@@ -0,0 +1,1075 @@
+/**
+ * @file    sensors.c
+ * @brief   Unified sensor interface implementation
+ * @author  Integration for ModbusWithSensorsNoRTOS and ModbusRTOS
+ *
+ * Shared by the bare-metal and the FreeRTOS build. Waiting for the ADC scan
+ * and the SCD30 RDY edge, and the critical sections against Modbus, go
+ * through the port (snport.h): the main loop spins, a task sleeps on a
+ * thread flag. Build-specific extras hook in through sensors_conf.h.
+ */
+
+#include "sensors.h"
+#include "health.h"
+#include "mq2_gas.h"
+#include "snport.h"
+#include "stm32f3xx_ll_adc.h" // VREFINT_CAL / TS_CAL factory calibration addresses
+#include <string.h>
+#if SENSORS_USE_BURST
+#include "mq2_burst.h"
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+extern ADC_HandleTypeDef hadc1;
+extern I2C_HandleTypeDef hi2c1;
+
+SensorData_t sensor_data = {0};
+
+// SCD30 settings; writes from Modbus only mark items pending, the SCD30 update sends them
+SCD30_Config_t scd30_config = {
+    .value = {2, 0, 0, 0, 1, 400}, // Sensor defaults: 2 s, no pressure comp., ASC on
+    .pending = 0,
+    .errors = 0,
+};
+
+/* SCD30 command issued for each SCD30_ConfigItem_t */
+static const uint16_t scd30_config_cmd[SCD30_CFG_COUNT] = {
+    SCD30_CMD_SET_INTERVAL,
+    SCD30_CMD_START_MEASUREMENT, // Pressure is the argument of (re)start measurement
+    SCD30_CMD_SET_ALTITUDE,
+    SCD30_CMD_SET_TEMP_OFFSET,
+    SCD30_CMD_SET_ASC,
+    SCD30_CMD_SET_FRC,
+};
+
+static uint8_t scd30_tx_buf[5];
+static uint8_t scd30_rx_buf[18];
+
+/* One scan of ADC1: MQ2 CH0-CH3, VREFINT, temperature sensor (filled by DMA) */
+static uint16_t adc_scan_buf[ADC_SCAN_LENGTH];
+
+/* ADC channel sampled at each scan rank */
+static const uint32_t adc_scan_channels[ADC_SCAN_LENGTH] = {
+    MQ2_CH0_CHANNEL,
+    MQ2_CH1_CHANNEL,
+    MQ2_CH2_CHANNEL,
+    MQ2_CH3_CHANNEL,
+    ADC_CHANNEL_VREFINT,
+    ADC_CHANNEL_TEMPSENSOR,
+};
+
+static const uint32_t adc_scan_ranks[ADC_SCAN_LENGTH] = {
+    ADC_REGULAR_RANK_1,
+    ADC_REGULAR_RANK_2,
+    ADC_REGULAR_RANK_3,
+    ADC_REGULAR_RANK_4,
+    ADC_REGULAR_RANK_5,
+    ADC_REGULAR_RANK_6,
+};
+
+/* Millivolts per ADC count in Q16, refreshed from VREFINT on every scan */
+static uint32_t adc_mv_per_count_q16 = (ADC_NOMINAL_VDDA_MV << 16) / ADC_FULL_SCALE;
+
+static volatile uint8_t scd30_rdy_flag = 0; // Set by RDY EXTI, cleared when serviced
+static uint32_t scd30_last_rdy_tick = 0;    // Last time RDY reported new data
+
+/* Sensor bring-up, run while Modbus is already serving */
+typedef enum
+{
+    SENSORS_INIT_ADC = 0,    // Configure and calibrate the ADC scan
+    SENSORS_INIT_SCD30_WAIT, // SCD30 still powering up
+    SENSORS_INIT_SCD30,      // Read SCD30 settings and start measuring
+    SENSORS_INIT_DONE
+} Sensors_InitState_t;
+
+static Sensors_InitState_t sensors_init_state = SENSORS_INIT_ADC;
+static uint8_t mq2_started = 0;   // ADC bring-up finished, scans may run
+static uint8_t scd30_started = 0; // SCD30 bring-up finished, I2C may be used
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef ADC_ConfigureScan(void);
+static HAL_StatusTypeDef ADC_RunScan(void);
+static void ADC_UpdateSupply(void);
+static uint16_t ADC_CountsToMillivolts(uint32_t raw_value);
+static void SCD30_ReportBusError(HAL_StatusTypeDef res);
+static HAL_StatusTypeDef SCD30_Transmit(uint8_t *data, uint16_t len, uint32_t timeout);
+static HAL_StatusTypeDef SCD30_Receive(uint8_t *data, uint16_t len, uint32_t timeout);
+static HAL_StatusTypeDef SCD30_WriteCommand(uint16_t cmd, uint16_t arg);
+static HAL_StatusTypeDef SCD30_ReadWord(uint16_t cmd, uint16_t *value);
+static void SCD30_ReadConfig(void);
+
+/* MQ2 Gas Sensor Functions -------------------------------------------------*/
+
+/**
+ * @brief  Initialize MQ2 sensors
+ * @param  None
+ * @retval HAL status
+ */
+HAL_StatusTypeDef MQ2_Init(void)
+{
+    // ADC is initialized by CubeMX; extend its sequence with the internal channels
+    if (ADC_ConfigureScan() != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+
+    // Calibrate the ADC (must run while the ADC is disabled)
+    if (HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+
+    // Initialize sensor data
+    memset(sensor_data.mq2_values, 0, sizeof(sensor_data.mq2_values));
+    memset(sensor_data.mq2_voltages, 0, sizeof(sensor_data.mq2_voltages));
+    memset(sensor_data.mq2_digital, 0, sizeof(sensor_data.mq2_digital));
+    sensor_data.vdda_mv = ADC_NOMINAL_VDDA_MV;
+    sensor_data.mcu_temp_c100 = 0;
+
+#if SENSORS_USE_BURST
+    // Burst capture sample clock (idle until armed)
+    MQ2_Burst_Init();
+#endif
+
+    return HAL_OK;
+}
+
+/**
+ * @brief  Configure ADC1 regular sequence: 4x MQ2, VREFINT, temperature sensor
+ * @param  None
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef ADC_ConfigureScan(void)
+{
+    ADC_ChannelConfTypeDef sConfig = {0};
+
+    hadc1.Init.NbrOfConversion = ADC_SCAN_LENGTH;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK)
+        return HAL_ERROR;
+
+    // 181.5 cycles also satisfies the >2.2 us sampling needed by VREFINT/TS
+    sConfig.SingleDiff = ADC_SINGLE_ENDED;
+    sConfig.SamplingTime = ADC_SAMPLETIME_181CYCLES_5;
+    sConfig.OffsetNumber = ADC_OFFSET_NONE;
+    sConfig.Offset = 0;
+
+    for (uint8_t i = 0; i < ADC_SCAN_LENGTH; i++)
+    {
+        sConfig.Channel = adc_scan_channels[i];
+        sConfig.Rank = adc_scan_ranks[i];
+        if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+            return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief  Convert the whole sequence once into adc_scan_buf
+ * @param  None
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef ADC_RunScan(void)
+{
+#if SENSORS_USE_BURST
+    // A burst capture is scanning at a much higher rate; use its latest scan
+    if (MQ2_Burst_IsSampling())
+    {
+        ADC_UpdateSupply();
+        return HAL_OK;
+    }
+#endif
+
+    snport_scan_begin();
+
+    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t *)adc_scan_buf, ADC_SCAN_LENGTH) != HAL_OK)
+        return HAL_ERROR;
+
+    // Six conversions take well under a millisecond; the timeout only guards
+    // against a stuck ADC
+    if (!snport_scan_wait(10))
+    {
+        HAL_ADC_Stop_DMA(&hadc1);
+        return HAL_TIMEOUT;
+    }
+
+    HAL_ADC_Stop_DMA(&hadc1);
+
+    ADC_UpdateSupply();
+    return HAL_OK;
+}
+
+/**
+ * @brief  Start one scan without waiting (burst sample clock, TIM6 interrupt)
+ * @param  None
+ * @retval HAL_BUSY/HAL_ERROR if the ADC is still converting
+ */
+HAL_StatusTypeDef MQ2_StartScan(void)
+{
+    return HAL_ADC_Start_DMA(&hadc1, (uint32_t *)adc_scan_buf, ADC_SCAN_LENGTH);
+}
+
+/**
+ * @brief  Derive true Vdda and die temperature from the last scan
+ * @param  None
+ * @retval None
+ * @note   Vdda = 3300 mV * VREFINT_CAL / VREFINT_raw (integer math only)
+ */
+static void ADC_UpdateSupply(void)
+{
+    uint32_t vref_raw = adc_scan_buf[ADC_SCAN_VREFINT_IDX];
+    uint32_t vref_cal = *VREFINT_CAL_ADDR;
+    uint32_t vdda_mv = ADC_NOMINAL_VDDA_MV;
+
+    // Ignore a missing/erased calibration word or an implausible reading
+    if (vref_raw != 0 && vref_cal != 0 && vref_cal != 0xFFFF)
+    {
+        vdda_mv = (VREFINT_CAL_VREF * vref_cal + vref_raw / 2) / vref_raw;
+        if (vdda_mv < 1800 || vdda_mv > 3600)
+            vdda_mv = ADC_NOMINAL_VDDA_MV;
+    }
+
+    sensor_data.vdda_mv = (uint16_t)vdda_mv;
+    adc_mv_per_count_q16 = (vdda_mv << 16) / ADC_FULL_SCALE;
+
+    // Scale the sensor reading to the 3.3 V it was calibrated at, then interpolate
+    // linearly between TS_CAL1 (30 C) and TS_CAL2 (110 C). Result in C x 100.
+    int32_t ts_cal1 = *TEMPSENSOR_CAL1_ADDR;
+    int32_t ts_cal2 = *TEMPSENSOR_CAL2_ADDR;
+    if (ts_cal1 != ts_cal2)
+    {
+        int32_t ts_raw = (int32_t)((adc_scan_buf[ADC_SCAN_TEMP_IDX] * vdda_mv) / TEMPSENSOR_CAL_VREFANALOG);
+        int32_t temp = ((ts_raw - ts_cal1) * (TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP) * 100) /
+                           (ts_cal2 - ts_cal1) +
+                       TEMPSENSOR_CAL1_TEMP * 100;
+        sensor_data.mcu_temp_c100 = (int16_t)temp;
+    }
+}
+
+/**
+ * @brief  Convert ADC counts to millivolts using the measured Vdda
+ * @param  raw_value: ADC counts (0-4095)
+ * @retval Voltage in millivolts
+ */
+static uint16_t ADC_CountsToMillivolts(uint32_t raw_value)
+{
+    // 4095 * (3600 << 16) / 4095 still fits in 32 bits
+    return (uint16_t)((raw_value * adc_mv_per_count_q16 + 0x8000) >> 16);
+}
+
+/**
+ * @brief  HAL ADC conversion complete callback (end of DMA scan)
+ * @param  hadc: ADC handle
+ * @retval None
+ */
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if (hadc == &hadc1)
+    {
+#if SENSORS_USE_BURST
+        SENSORS_TRACE_ADC_FRAME(MQ2_Burst_IsSampling());
+
+        // Burst scans are started from TIM6; release the ADC for the next one
+        if (MQ2_Burst_IsSampling())
+        {
+            HAL_ADC_Stop_DMA(&hadc1);
+            MQ2_Burst_OnScan(adc_scan_buf);
+            return;
+        }
+#else
+        SENSORS_TRACE_ADC_FRAME(0);
+#endif
+
+        // Wake whoever waits in ADC_RunScan()
+        snport_scan_done_from_isr();
+    }
+}
+
+/**
+ * @brief  Read single MQ2 channel
+ * @param  channel: Channel number (0-3)
+ * @param  adc_value: Pointer to store raw ADC value
+ * @param  voltage_mv: Pointer to store voltage in millivolts (Vdda compensated)
+ * @retval HAL status
+ */
+HAL_StatusTypeDef MQ2_ReadChannel(uint8_t channel, uint16_t *adc_value, uint16_t *voltage_mv)
+{
+    if (channel >= MQ2_NUM_CHANNELS)
+        return HAL_ERROR;
+
+    // One scan converts every channel plus VREFINT, so Vdda is always current
+    if (ADC_RunScan() != HAL_OK)
+        return HAL_ERROR;
+
+    *adc_value = adc_scan_buf[channel];
+    *voltage_mv = ADC_CountsToMillivolts(adc_scan_buf[channel]);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief  Read MQ2 digital output (gas detection)
+ * @param  channel: Channel number (0-3)
+ * @param  gas_detected: Pointer to store gas detection status (1=gas, 0=no gas)
+ * @retval HAL status
+ */
+HAL_StatusTypeDef MQ2_ReadDigitalChannel(uint8_t channel, uint8_t *gas_detected)
+{
+    if (channel >= MQ2_NUM_CHANNELS)
+        return HAL_ERROR;
+
+    GPIO_TypeDef *gpio_port;
+    uint16_t gpio_pin;
+
+    // Select the appropriate GPIO port and pin for this channel
+    switch (channel)
+    {
+    case 0:
+        gpio_port = MQ2_CH0_DOUT_GPIO;
+        gpio_pin = MQ2_CH0_DOUT_PIN;
+        break;
+    case 1:
+        gpio_port = MQ2_CH1_DOUT_GPIO;
+        gpio_pin = MQ2_CH1_DOUT_PIN;
+        break;
+    case 2:
+        gpio_port = MQ2_CH2_DOUT_GPIO;
+        gpio_pin = MQ2_CH2_DOUT_PIN;
+        break;
+    case 3:
+        gpio_port = MQ2_CH3_DOUT_GPIO;
+        gpio_pin = MQ2_CH3_DOUT_PIN;
+        break;
+    default:
+        return HAL_ERROR;
+    }
+
+    // Read GPIO pin state
+    GPIO_PinState pin_state = HAL_GPIO_ReadPin(gpio_port, gpio_pin);
+
+    // MQ2 DOUT is typically active LOW (0 = gas detected, 1 = no gas)
+    // Convert to logical high = gas detected for easier understanding
+    *gas_detected = (pin_state == GPIO_PIN_RESET) ? 1 : 0;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief  Read all MQ2 channels (analog + digital) and update sensor data
+ * @param  None
+ * @retval HAL status
+ */
+HAL_StatusTypeDef MQ2_ReadAllChannels(void)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+
+    // Single scan for all analog channels (and the Vdda reference)
+    HAL_StatusTypeDef scan = ADC_RunScan();
+    if (scan != HAL_OK)
+    {
+        status = HAL_ERROR;
+    }
+
+    for (uint8_t i = 0; i < MQ2_NUM_CHANNELS; i++)
+    {
+        // Analog values (ADC + voltage) from the scan
+        if (status == HAL_OK)
+        {
+            sensor_data.mq2_values[i] = adc_scan_buf[i];
+            sensor_data.mq2_voltages[i] = ADC_CountsToMillivolts(adc_scan_buf[i]);
+            MQ2_Gas_Update(i, sensor_data.mq2_voltages[i]);
+
+            // Near 0 V: heater off or module unplugged; full scale: AOUT above Vdda
+            if (sensor_data.mq2_voltages[i] < MQ2_COLD_MV || adc_scan_buf[i] >= ADC_FULL_SCALE)
+                Health_ReportError((Health_Sensor_t)(HEALTH_MQ2_CH0 + i), HEALTH_ERR_RANGE);
+            else
+                Health_ReportGood((Health_Sensor_t)(HEALTH_MQ2_CH0 + i));
+        }
+        else
+        {
+            Health_ReportError((Health_Sensor_t)(HEALTH_MQ2_CH0 + i),
+                               (scan == HAL_TIMEOUT) ? HEALTH_ERR_TIMEOUT : HEALTH_ERR_NACK);
+        }
+
+        // Read digital gas detection
+        if (MQ2_ReadDigitalChannel(i, &sensor_data.mq2_digital[i]) != HAL_OK)
+        {
+            status = HAL_ERROR;
+        }
+    }
+
+    return status;
+}
+
+/* SCD30 Environmental Sensor Functions -------------------------------------*/
+
+/**
+ * @brief  Count a failed SCD30 transfer in the sensor's health record
+ * @param  res: HAL status of the transfer
+ * @retval None
+ */
+static void SCD30_ReportBusError(HAL_StatusTypeDef res)
+{
+    if (res == HAL_TIMEOUT || (HAL_I2C_GetError(&hi2c1) & HAL_I2C_ERROR_TIMEOUT))
+        Health_ReportError(HEALTH_SCD30, HEALTH_ERR_TIMEOUT);
+    else
+        Health_ReportError(HEALTH_SCD30, HEALTH_ERR_NACK); // AF, bus error, arbitration lost
+}
+
+/**
+ * @brief  I2C write to SCD30 (counted as one bus transaction)
+ * @param  data: Bytes to send
+ * @param  len: Number of bytes
+ * @param  timeout: HAL timeout in ms
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef SCD30_Transmit(uint8_t *data, uint16_t len, uint32_t timeout)
+{
+    sensor_data.scd30_i2c_transactions++;
+    SENSORS_TRACE_I2C_START(len);
+    HAL_StatusTypeDef res = HAL_I2C_Master_Transmit(&hi2c1, SCD30_I2C_ADDR, data, len, timeout);
+    SENSORS_TRACE_I2C_END(res);
+    if (res != HAL_OK)
+        SCD30_ReportBusError(res);
+    return res;
+}
+
+/**
+ * @brief  I2C read from SCD30 (counted as one bus transaction)
+ * @param  data: Buffer for received bytes
+ * @param  len: Number of bytes
+ * @param  timeout: HAL timeout in ms
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef SCD30_Receive(uint8_t *data, uint16_t len, uint32_t timeout)
+{
+    sensor_data.scd30_i2c_transactions++;
+    SENSORS_TRACE_I2C_START(0x8000 | len);
+    HAL_StatusTypeDef res = HAL_I2C_Master_Receive(&hi2c1, SCD30_I2C_ADDR, data, len, timeout);
+    SENSORS_TRACE_I2C_END(res);
+    if (res != HAL_OK)
+        SCD30_ReportBusError(res);
+    return res;
+}
+
+/**
+ * @brief  Initialize SCD30 sensor
+ * @param  None
+ * @retval HAL status
+ */
+HAL_StatusTypeDef SCD30_Init(void)
+{
+    // I2C is already initialized by CubeMX
+    // Initialize sensor data
+    sensor_data.scd30_co2 = 0.0f;
+    sensor_data.scd30_temperature = 0.0f;
+    sensor_data.scd30_humidity = 0.0f;
+    sensor_data.scd30_data_ready = 0;
+    sensor_data.scd30_rdy_mode = SCD30_USE_RDY_PIN;
+    sensor_data.scd30_i2c_transactions = 0;
+    sensor_data.scd30_samples = 0;
+
+    // Give the RDY pin one full timeout window before falling back to polling
+    scd30_rdy_flag = 0;
+    scd30_last_rdy_tick = HAL_GetTick();
+
+    // Pick up the settings the sensor keeps in its own non-volatile memory
+    SCD30_ReadConfig();
+
+    // Start continuous measurement
+    return SCD30_StartMeasurement();
+}
+
+/**
+ * @brief  Send SCD30 command with one 16-bit argument
+ * @param  cmd: Command code
+ * @param  arg: Argument word (CRC is appended)
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef SCD30_WriteCommand(uint16_t cmd, uint16_t arg)
+{
+    scd30_tx_buf[0] = (cmd >> 8) & 0xFF;
+    scd30_tx_buf[1] = cmd & 0xFF;
+    scd30_tx_buf[2] = (arg >> 8) & 0xFF;
+    scd30_tx_buf[3] = arg & 0xFF;
+    scd30_tx_buf[4] = SCD30_CalcCRC(&scd30_tx_buf[2], 2);
+
+    return SCD30_Transmit(scd30_tx_buf, 5, 100);
+}
+
+/**
+ * @brief  Send SCD30 command and read back one CRC-protected word
+ * @param  cmd: Command code
+ * @param  value: Pointer to store the received word
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef SCD30_ReadWord(uint16_t cmd, uint16_t *value)
+{
+    uint8_t tx[2] = {(cmd >> 8) & 0xFF, cmd & 0xFF};
+    uint8_t rx[3];
+
+    HAL_StatusTypeDef res = SCD30_Transmit(tx, 2, 100);
+    if (res != HAL_OK)
+        return res;
+
+    res = SCD30_Receive(rx, 3, 100);
+    if (res != HAL_OK)
+        return res;
+
+    // Verify CRC
+    if (SCD30_CheckFrameCRC(rx, 1) != 0)
+    {
+        Health_ReportError(HEALTH_SCD30, HEALTH_ERR_CRC);
+        return HAL_ERROR;
+    }
+
+    *value = (rx[0] << 8) | rx[1];
+    return HAL_OK;
+}
+
+/**
+ * @brief  Load persistent SCD30 settings into scd30_config
+ * @param  None
+ * @retval None
+ * @note   Ambient pressure is not readable and keeps its local value
+ */
+static void SCD30_ReadConfig(void)
+{
+    uint16_t value;
+
+    for (uint8_t item = 0; item < SCD30_CFG_COUNT; item++)
+    {
+        if (item == SCD30_CFG_PRESSURE)
+            continue;
+
+        if (SCD30_ReadWord(scd30_config_cmd[item], &value) == HAL_OK)
+        {
+            scd30_config.value[item] = value;
+        }
+    }
+}
+
+/**
+ * @brief  Start SCD30 continuous measurement
+ * @param  None
+ * @retval HAL status
+ */
+HAL_StatusTypeDef SCD30_StartMeasurement(void)
+{
+    // Argument 0x0000 disables ambient pressure compensation
+    return SCD30_WriteCommand(SCD30_CMD_START_MEASUREMENT, scd30_config.value[SCD30_CFG_PRESSURE]);
+}
+
+/**
+ * @brief  Check if SCD30 data is ready
+ * @param  ready: Pointer to store ready status
+ * @retval HAL status
+ */
+HAL_StatusTypeDef SCD30_DataReady(uint8_t *ready)
+{
+    uint16_t value;
+
+    HAL_StatusTypeDef res = SCD30_ReadWord(SCD30_CMD_GET_DATA_READY, &value);
+    if (res != HAL_OK)
+        return res;
+
+    *ready = (value != 0) ? 1 : 0;
+    return HAL_OK;
+}
+
+/**
+ * @brief  Queue a new SCD30 setting (safe to call from Modbus)
+ * @param  item: Setting to change
+ * @param  value: New value in register units
+ * @retval HAL_ERROR if the value is outside the sensor's accepted range
+ */
+HAL_StatusTypeDef SCD30_RequestConfig(SCD30_ConfigItem_t item, uint16_t value)
+{
+    switch (item)
+    {
+    case SCD30_CFG_INTERVAL:
+        if (value < 2 || value > 1800)
+            return HAL_ERROR;
+        break;
+    case SCD30_CFG_PRESSURE:
+        if (value != 0 && (value < 700 || value > 1400))
+            return HAL_ERROR;
+        break;
+    case SCD30_CFG_ASC:
+        if (value > 1)
+            return HAL_ERROR;
+        break;
+    case SCD30_CFG_FRC:
+        if (value < 400 || value > 2000)
+            return HAL_ERROR;
+        break;
+    case SCD30_CFG_ALTITUDE:
+    case SCD30_CFG_TEMP_OFFSET:
+        break;
+    default:
+        return HAL_ERROR;
+    }
+
+    scd30_config.value[item] = value;
+    scd30_config.pending |= (1U << item);
+    return HAL_OK;
+}
+
+/**
+ * @brief  Send queued SCD30 settings (sensor update context, blocking I2C)
+ * @param  None
+ * @retval None
+ */
+void SCD30_ApplyPendingConfig(void)
+{
+    for (uint8_t item = 0; item < SCD30_CFG_COUNT; item++)
+    {
+        uint16_t bit = (1U << item);
+
+        // Take the item atomically so a Modbus write arriving meanwhile is not lost
+        snport_enter_critical();
+        uint16_t pending = scd30_config.pending & bit;
+        uint16_t value = scd30_config.value[item];
+        scd30_config.pending &= ~bit;
+        snport_exit_critical();
+
+        if (!pending)
+            continue;
+
+        if (SCD30_WriteCommand(scd30_config_cmd[item], value) == HAL_OK)
+        {
+            scd30_config.errors &= ~bit;
+            if (item == SCD30_CFG_INTERVAL)
+                SENSORS_ON_SCD30_INTERVAL(value);
+        }
+        else
+        {
+            // Retry on the next update
+            scd30_config.errors |= bit;
+            snport_enter_critical();
+            scd30_config.pending |= bit;
+            snport_exit_critical();
+        }
+    }
+}
+
+/**
+ * @brief  Read SCD30 measurement data
+ * @param  co2: Pointer to store CO2 value (ppm)
+ * @param  temperature: Pointer to store temperature (°C)
+ * @param  humidity: Pointer to store humidity (%)
+ * @retval HAL status
+ */
+HAL_StatusTypeDef SCD30_ReadMeasurement(float *co2, float *temperature, float *humidity)
+{
+    scd30_tx_buf[0] = (SCD30_CMD_READ_MEASUREMENT >> 8) & 0xFF;
+    scd30_tx_buf[1] = SCD30_CMD_READ_MEASUREMENT & 0xFF;
+
+    HAL_StatusTypeDef res = SCD30_Transmit(scd30_tx_buf, 2, 100);
+    if (res != HAL_OK)
+        return res;
+
+    res = SCD30_Receive(scd30_rx_buf, 18, 200);
+    if (res != HAL_OK)
+        return res;
+
+    // Check the CRC of all six 2-byte words at once
+    if (SCD30_CheckFrameCRC(scd30_rx_buf, 6) != 0)
+    {
+        Health_ReportError(HEALTH_SCD30, HEALTH_ERR_CRC);
+        return HAL_ERROR;
+    }
+
+    // Parse 3 float values (each: 4 bytes + CRC per 2 bytes)
+    uint8_t data[12];
+    for (int i = 0, j = 0; i < 18; i += 6)
+    {
+        data[j++] = scd30_rx_buf[i];
+        data[j++] = scd30_rx_buf[i + 1];
+        data[j++] = scd30_rx_buf[i + 3];
+        data[j++] = scd30_rx_buf[i + 4];
+    }
+
+    // Convert from big-endian to little-endian and copy to float
+    // SCD30 sends data in big-endian format, STM32 uses little-endian
+    // Use the exact same method as working SCD30 project
+    uint8_t co2_bytes[4] = {data[3], data[2], data[1], data[0]};
+    uint8_t temperature_bytes[4] = {data[7], data[6], data[5], data[4]};
+    uint8_t humidity_bytes[4] = {data[11], data[10], data[9], data[8]};
+
+    memcpy(co2, co2_bytes, 4);
+    memcpy(temperature, temperature_bytes, 4);
+    memcpy(humidity, humidity_bytes, 4);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief  SCD30 RDY pin rising edge (called from HAL_GPIO_EXTI_Callback)
+ * @param  None
+ * @retval None
+ */
+void SCD30_RdyCallback(void)
+{
+    scd30_rdy_flag = 1;
+
+    // An edge proves the pin is wired, so leave polling fallback
+    sensor_data.scd30_rdy_mode = 1;
+
+    snport_rdy_from_isr();
+}
+
+/**
+ * @brief  Wait until the RDY edge or the timeout, whichever comes first
+ * @param  timeout_ms: Longest wait; the polling fallback relies on it alone
+ * @retval None
+ * @note   For a task that only runs the SCD30; the main loop polls
+ *         SCD30_RdyPending() instead.
+ */
+void SCD30_WaitForData(uint32_t timeout_ms)
+{
+    snport_rdy_begin();
+
+    // An edge that arrived while the caller was busy is still in scd30_rdy_flag
+    if (scd30_rdy_flag)
+        return;
+
+    snport_rdy_wait(timeout_ms);
+}
+
+/**
+ * @brief  Check whether the RDY pin has signalled a measurement not yet read
+ * @param  None
+ * @retval 1 if a measurement is waiting, 0 otherwise
+ */
+uint8_t SCD30_RdyPending(void)
+{
+    // RDY may still be driven by a measurement from before the reset
+    if (!scd30_started)
+        return 0;
+    return scd30_rdy_flag;
+}
+
+/**
+ * @brief  Average number of I2C transactions spent per successful measurement
+ * @param  None
+ * @retval Transactions per sample x 100 (0 before the first sample)
+ */
+uint16_t SCD30_GetTransactionsPerSample(void)
+{
+    if (sensor_data.scd30_samples == 0)
+        return 0;
+
+    uint32_t ratio = (sensor_data.scd30_i2c_transactions * 100) / sensor_data.scd30_samples;
+    return (ratio > 65535) ? 65535 : (uint16_t)ratio;
+}
+
+/**
+ * @brief  Update SCD30 data if ready
+ * @param  None
+ * @retval HAL status
+ */
+HAL_StatusTypeDef SCD30_UpdateData(void)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+
+    // A reading older than three measurement intervals is stale
+    Health_SetStaleLimit(HEALTH_SCD30, scd30_config.value[SCD30_CFG_INTERVAL] * 3000UL);
+
+    if (sensor_data.scd30_rdy_mode)
+    {
+        // RDY mode: no bus traffic unless the sensor says a sample is waiting.
+        // The level check also covers an edge that happened before EXTI was armed.
+        if (scd30_rdy_flag || HAL_GPIO_ReadPin(SCD30_RDY_GPIO, SCD30_RDY_PIN) == GPIO_PIN_SET)
+        {
+            scd30_rdy_flag = 0;
+            scd30_last_rdy_tick = HAL_GetTick();
+            sensor_data.scd30_data_ready = 1;
+        }
+        else
+        {
+            sensor_data.scd30_data_ready = 0;
+
+            // Pin never toggles -> not connected, fall back to polling.
+            // Allow two measurement intervals so long intervals don't trip it.
+            uint32_t timeout = (uint32_t)scd30_config.value[SCD30_CFG_INTERVAL] * 2000 + 1000;
+            if (timeout < SCD30_RDY_TIMEOUT_MS)
+                timeout = SCD30_RDY_TIMEOUT_MS;
+
+            if ((HAL_GetTick() - scd30_last_rdy_tick) > timeout)
+            {
+                sensor_data.scd30_rdy_mode = 0;
+            }
+            return HAL_OK;
+        }
+    }
+    else
+    {
+        // Polling fallback: ask the sensor with the 0x0202 command
+        status = SCD30_DataReady(&sensor_data.scd30_data_ready);
+    }
+
+    if (status != HAL_OK)
+    {
+        // Communication failed, reset values to indicate error
+        sensor_data.scd30_co2 = 0.0f;
+        sensor_data.scd30_temperature = -273.15f; // Absolute zero indicates error
+        sensor_data.scd30_humidity = 0.0f;
+        sensor_data.scd30_data_ready = 0;
+        return HAL_ERROR;
+    }
+
+    // Read measurement if data is ready
+    if (sensor_data.scd30_data_ready)
+    {
+        status = SCD30_ReadMeasurement(&sensor_data.scd30_co2,
+                                       &sensor_data.scd30_temperature,
+                                       &sensor_data.scd30_humidity);
+
+        if (status != HAL_OK)
+        {
+            // Read failed, reset values to indicate error
+            sensor_data.scd30_co2 = 0.0f;
+            sensor_data.scd30_temperature = -273.15f; // Absolute zero indicates error
+            sensor_data.scd30_humidity = 0.0f;
+            return HAL_ERROR;
+        }
+
+        // Validate readings are reasonable
+        if (sensor_data.scd30_temperature < -40.0f || sensor_data.scd30_temperature > 70.0f ||
+            sensor_data.scd30_humidity < 0.0f || sensor_data.scd30_humidity > 100.0f ||
+            sensor_data.scd30_co2 < 0.0f || sensor_data.scd30_co2 > 40000.0f)
+        {
+            // Invalid readings, reset to error values
+            sensor_data.scd30_co2 = 0.0f;
+            sensor_data.scd30_temperature = -273.15f; // Absolute zero indicates error
+            sensor_data.scd30_humidity = 0.0f;
+            Health_ReportError(HEALTH_SCD30, HEALTH_ERR_RANGE);
+            return HAL_ERROR;
+        }
+
+        sensor_data.scd30_samples++;
+        Health_ReportGood(HEALTH_SCD30);
+
+        // Refresh MQ2 temperature/humidity compensation once per new sample;
+        // it stays valid for three measurement intervals
+        MQ2_Gas_SetEnvironment((int16_t)(sensor_data.scd30_temperature * 100.0f),
+                               (uint16_t)(sensor_data.scd30_humidity * 100.0f),
+                               scd30_config.value[SCD30_CFG_INTERVAL] * 3000UL);
+    }
+
+    return HAL_OK;
+}
+
+/* Unified Sensor Interface -------------------------------------------------*/
+
+/**
+ * @brief  Prepare the sensor bring-up (no hardware access)
+ * @param  None
+ * @retval None
+ * @note   Sensors_StartMQ2() and Sensors_StartSCD30() do the bring-up later
+ *         (main loop: Sensors_InitStep(), RTOS: the sensor tasks), so Modbus
+ *         can start right away; the sensors read as "initialising" meanwhile.
+ */
+void Sensors_Init(void)
+{
+    // Health records first, so init failures are counted
+    Health_Init();
+
+    // Rs/R0 and ppm estimation; RAM only, set before Modbus can write R0
+    MQ2_Gas_Init();
+
+    sensors_init_state = SENSORS_INIT_ADC;
+    mq2_started = 0;
+    scd30_started = 0;
+    sensor_data.scd30_rdy_mode = SCD30_USE_RDY_PIN;
+
+    // Update timestamp
+    sensor_data.last_update = HAL_GetTick();
+}
+
+/**
+ * @brief  Bring up the MQ2 channels: ADC scan sequence and calibration
+ * @param  None
+ * @retval HAL status (a failure is also counted in the health records)
+ */
+HAL_StatusTypeDef Sensors_StartMQ2(void)
+{
+    // Scan sequence and calibration (a few microseconds)
+    HAL_StatusTypeDef status = MQ2_Init();
+
+    for (uint8_t i = 0; i < MQ2_NUM_CHANNELS; i++)
+    {
+        Health_ReportStarted((Health_Sensor_t)(HEALTH_MQ2_CH0 + i));
+        if (status != HAL_OK)
+            Health_ReportError((Health_Sensor_t)(HEALTH_MQ2_CH0 + i), HEALTH_ERR_NACK);
+    }
+
+    mq2_started = 1;
+    SENSORS_ON_MQ2_STARTED();
+    return status;
+}
+
+/**
+ * @brief  Bring up the SCD30: read its settings and start measuring
+ * @param  None
+ * @retval HAL status of the start command
+ * @note   Call no earlier than SCD30_STARTUP_MS after power-up.
+ */
+HAL_StatusTypeDef Sensors_StartSCD30(void)
+{
+    // Failed transfers are already counted by the I2C wrappers
+    HAL_StatusTypeDef status = SCD30_Init();
+
+    Health_ReportStarted(HEALTH_SCD30);
+    scd30_started = 1;
+    SENSORS_ON_SCD30_INTERVAL(scd30_config.value[SCD30_CFG_INTERVAL]);
+    SENSORS_ON_SCD30_STARTED();
+    return status;
+}
+
+/**
+ * @brief  Run the next step of the sensor bring-up (main loop)
+ * @param  None
+ * @retval 1 if a step ran, 0 if waiting or done
+ */
+uint8_t Sensors_InitStep(void)
+{
+    switch (sensors_init_state)
+    {
+    case SENSORS_INIT_ADC:
+        Sensors_StartMQ2();
+        sensors_init_state = SENSORS_INIT_SCD30_WAIT;
+        return 1;
+
+    case SENSORS_INIT_SCD30_WAIT:
+        // The SCD30 powers up with the MCU; the HAL tick counts from reset
+        if (HAL_GetTick() < SCD30_STARTUP_MS)
+        {
+            return 0;
+        }
+        sensors_init_state = SENSORS_INIT_SCD30;
+        return 1;
+
+    case SENSORS_INIT_SCD30:
+        Sensors_StartSCD30();
+        sensors_init_state = SENSORS_INIT_DONE;
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief  Update all sensor readings
+ * @param  None
+ * @retval None
+ */
+void Sensors_UpdateAll(void)
+{
+    Sensors_UpdateMQ2();
+    Sensors_UpdateSCD30();
+}
+
+/**
+ * @brief  Update the MQ2 readings (every second)
+ * @param  None
+ * @retval None
+ */
+void Sensors_UpdateMQ2(void)
+{
+    if (!mq2_started)
+        return;
+
+    MQ2_ReadAllChannels();
+
+    // Update timestamp
+    sensor_data.last_update = HAL_GetTick();
+}
+
+/**
+ * @brief  Update the SCD30 readings (on RDY or at the measurement interval)
+ * @param  None
+ * @retval None
+ */
+void Sensors_UpdateSCD30(void)
+{
+    if (!scd30_started)
+        return;
+
+    // Send SCD30 settings written over Modbus since the last update
+    SCD30_ApplyPendingConfig();
+
+    // Update SCD30 sensor
+    SCD30_UpdateData();
+
+    // Update timestamp
+    sensor_data.last_update = HAL_GetTick();
+}
+
+/**
+ * @brief  Get MQ2 raw ADC value
+ * @param  channel: Channel number (0-3)
+ * @retval Raw ADC value (0-4095)
+ */
+uint16_t Sensors_GetMQ2Value(uint8_t channel)
+{
+    if (channel >= MQ2_NUM_CHANNELS)
+        return 0;
+    return sensor_data.mq2_values[channel];
+}
+
+/**
+ * @brief  Get MQ2 voltage in millivolts
+ * @param  channel: Channel number (0-3)
+ * @retval Voltage in millivolts
+ */
+uint16_t Sensors_GetMQ2Voltage(uint8_t channel)
+{
+    if (channel >= MQ2_NUM_CHANNELS)
+        return 0;
+    return sensor_data.mq2_voltages[channel];
+}
+
+/**
+ * @brief  Get MQ2 digital gas detection status
+ * @param  channel: Channel number (0-3)
+ * @retval Gas detection status (1=gas detected, 0=no gas)
+ */
+uint8_t Sensors_GetMQ2Digital(uint8_t channel)
+{
+    if (channel >= MQ2_NUM_CHANNELS)
+        return 0;
+    return sensor_data.mq2_digital[channel];
+}
+
+/**
+ * @brief  Get SCD30 CO2 concentration
+ * @param  None
+ * @retval CO2 concentration in ppm
+ */
+float Sensors_GetSCD30_CO2(void)
+{
+    return sensor_data.scd30_co2;
+}
+
+/**
+ * @brief  Get SCD30 temperature
+ * @param  None
+ * @retval Temperature in Celsius
+ */
+float Sensors_GetSCD30_Temperature(void)
+{
+    return sensor_data.scd30_temperature;
+}
+
+/**
+ * @brief  Get SCD30 humidity
+ * @param  None
+ * @retval Relative humidity in %
+ */
+float Sensors_GetSCD30_Humidity(void)
+{
+    return sensor_data.scd30_humidity;
+}
\ No newline at end of file
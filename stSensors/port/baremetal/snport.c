@@ -0,0 +1,92 @@
+/**
+ * @file    snport.c
+ * @brief   stSensors port for bare-metal builds (main loop + interrupts)
+ *
+ * Critical sections mask interrupts through PRIMASK and restore the state
+ * found on entry, so they nest and may be used with interrupts already
+ * masked. Waits spin on a flag set from the interrupt, bounded by the HAL
+ * tick. In interrupt context neither the flag nor the tick can move (the
+ * DMA and SysTick interrupts do not preempt an equal or higher priority
+ * handler), so a wait there fails at once instead of hanging the device.
+ */
+
+#include "snport.h"
+#include "main.h"
+
+/* Private variables */
+static uint32_t snport_primask;        // PRIMASK found by the outermost enter
+static uint32_t snport_nesting;        // Depth of nested critical sections
+static volatile uint8_t snport_scan_done;
+static volatile uint8_t snport_rdy;
+
+/* Private functions */
+
+static uint8_t snport_spin(volatile uint8_t *flag, uint32_t timeout_ms)
+{
+    if (__get_IPSR() != 0)
+    {
+        return 0;
+    }
+
+    uint32_t start = HAL_GetTick();
+
+    while (!*flag)
+    {
+        if (HAL_GetTick() - start > timeout_ms)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Exported functions */
+
+void snport_enter_critical(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (snport_nesting++ == 0)
+    {
+        snport_primask = primask;
+    }
+}
+
+void snport_exit_critical(void)
+{
+    if (--snport_nesting == 0)
+    {
+        __set_PRIMASK(snport_primask);
+    }
+}
+
+void snport_scan_begin(void)
+{
+    snport_scan_done = 0;
+}
+
+void snport_scan_done_from_isr(void)
+{
+    snport_scan_done = 1;
+}
+
+uint8_t snport_scan_wait(uint32_t timeout_ms)
+{
+    return snport_spin(&snport_scan_done, timeout_ms);
+}
+
+void snport_rdy_begin(void)
+{
+    snport_rdy = 0;
+}
+
+void snport_rdy_from_isr(void)
+{
+    snport_rdy = 1;
+}
+
+void snport_rdy_wait(uint32_t timeout_ms)
+{
+    // The main loop polls SCD30_RdyPending() and never waits here in practice
+    snport_spin(&snport_rdy, timeout_ms);
+}
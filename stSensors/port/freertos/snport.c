@@ -0,0 +1,71 @@
+/**
+ * @file    snport.c
+ * @brief   stSensors port for FreeRTOS builds (CMSIS-RTOS v2)
+ *
+ * Critical sections are the kernel's and nest. The ADC scan and the SCD30
+ * RDY edge wake the task waiting for them with a thread flag; the task
+ * sleeps meanwhile, so a slow I2C sensor never holds up a higher priority
+ * task. *_begin() records the waiting task, so an event that arrives before
+ * *_wait() is kept in its thread flags rather than lost.
+ */
+
+#include "snport.h"
+#include "cmsis_os.h"
+#include "task.h"
+
+/* Private constants */
+#define SNPORT_FLAG_SCAN 0x0001U // ADC scan complete (MQ2 task)
+#define SNPORT_FLAG_RDY 0x0002U  // SCD30 RDY rising edge (SCD30 task)
+
+/* Private variables */
+static osThreadId_t snport_scan_thread; // Task waiting for the scan to finish
+static osThreadId_t snport_rdy_thread;  // Task waiting for the RDY edge
+
+/* Exported functions */
+
+void snport_enter_critical(void)
+{
+    taskENTER_CRITICAL();
+}
+
+void snport_exit_critical(void)
+{
+    taskEXIT_CRITICAL();
+}
+
+void snport_scan_begin(void)
+{
+    snport_scan_thread = osThreadGetId();
+    osThreadFlagsClear(SNPORT_FLAG_SCAN);
+}
+
+void snport_scan_done_from_isr(void)
+{
+    if (snport_scan_thread != NULL)
+    {
+        osThreadFlagsSet(snport_scan_thread, SNPORT_FLAG_SCAN);
+    }
+}
+
+uint8_t snport_scan_wait(uint32_t timeout_ms)
+{
+    return (osThreadFlagsWait(SNPORT_FLAG_SCAN, osFlagsWaitAny, timeout_ms) & osFlagsError) ? 0 : 1;
+}
+
+void snport_rdy_begin(void)
+{
+    snport_rdy_thread = osThreadGetId();
+}
+
+void snport_rdy_from_isr(void)
+{
+    if (snport_rdy_thread != NULL)
+    {
+        osThreadFlagsSet(snport_rdy_thread, SNPORT_FLAG_RDY);
+    }
+}
+
+void snport_rdy_wait(uint32_t timeout_ms)
+{
+    osThreadFlagsWait(SNPORT_FLAG_RDY, osFlagsWaitAny, timeout_ms);
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    test_scd30_crc.c
+ * @brief   Host test and benchmark of the table-driven SCD30 CRC-8
+ *
+ * The table must give the same CRC as the bitwise definition in the
+ * Sensirion datasheet for every input the driver sends or receives (one
+ * 16-bit word), and SCD30_CheckFrameCRC() must flag exactly the corrupted
+ * words of a measurement frame. The benchmark prints the time per word of
+ * both versions on this host.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "scd30_crc.h"
+#include "test.h"
+#include <time.h>
+
+/* Private constants */
+#define BENCH_WORDS 1000000U
+
+/* Private functions */
+
+// Bitwise CRC-8 as specified: polynomial 0x31, init 0xFF, MSB first, no final XOR
+static uint8_t crc_bitwise(const uint8_t *data, uint8_t len)
+{
+    uint8_t crc = 0xFF;
+
+    for (uint8_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Six words with good CRCs, as the SCD30 sends a measurement
+static void build_frame(uint8_t *frame)
+{
+    for (int i = 0; i < 18; i++)
+        frame[i] = (uint8_t)(i * 37);
+    for (int w = 0; w < 6; w++)
+        frame[w * 3 + 2] = crc_bitwise(&frame[w * 3], 2);
+}
+
+/* Tests */
+
+static void test_equivalence(void)
+{
+    uint32_t mismatches = 0;
+
+    for (uint32_t word = 0; word < 0x10000; word++)
+    {
+        uint8_t data[2] = {word >> 8, word & 0xFF};
+        if (SCD30_CalcCRC(data, 2) != crc_bitwise(data, 2))
+            mismatches++;
+    }
+    CHECK(mismatches == 0, "table CRC = bitwise CRC for all 65536 words");
+
+    // Longer inputs and the empty one
+    uint8_t data[8] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+    int same = 1;
+    for (uint8_t len = 0; len <= sizeof(data); len++)
+        same &= SCD30_CalcCRC(data, len) == crc_bitwise(data, len);
+    CHECK(same, "table CRC = bitwise CRC for 0-8 bytes");
+
+    const uint8_t beef[] = {0xBE, 0xEF};
+    CHECK(SCD30_CalcCRC(beef, 2) == 0x92, "datasheet example 0xBEEF -> 0x92");
+}
+
+static void test_frame_check(void)
+{
+    uint8_t frame[18];
+
+    build_frame(frame);
+    CHECK(SCD30_CheckFrameCRC(frame, 6) == 0, "good frame passes");
+
+    frame[7] ^= 0x01;  // Word 2, LSB
+    frame[15] ^= 0x04; // Word 5, MSB
+    CHECK(SCD30_CheckFrameCRC(frame, 6) == 0x24, "corrupted words 2 and 5 flagged");
+
+    build_frame(frame);
+    frame[2] ^= 0x80; // Word 0, CRC byte
+    CHECK(SCD30_CheckFrameCRC(frame, 6) == 0x01, "corrupted CRC byte flagged");
+    CHECK(SCD30_CheckFrameCRC(frame + 3, 5) == 0, "word count limits the check");
+}
+
+static void bench(void)
+{
+    volatile uint8_t sink = 0;
+    uint8_t data[2];
+    double start;
+
+    start = now_ns();
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        data[0] = i >> 8;
+        data[1] = i;
+        sink ^= crc_bitwise(data, 2);
+    }
+    double bitwise_ns = (now_ns() - start) / BENCH_WORDS;
+
+    start = now_ns();
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        data[0] = i >> 8;
+        data[1] = i;
+        sink ^= SCD30_CalcCRC(data, 2);
+    }
+    double table_ns = (now_ns() - start) / BENCH_WORDS;
+
+    uint8_t frame[18];
+    build_frame(frame);
+    start = now_ns();
+    for (uint32_t i = 0; i < BENCH_WORDS / 6; i++)
+    {
+        frame[0] = i;
+        sink ^= SCD30_CheckFrameCRC(frame, 6);
+    }
+    double frame_ns = (now_ns() - start) / (BENCH_WORDS / 6);
+
+    printf("bench: bitwise %.2f ns/word, table %.2f ns/word, 6-word frame %.2f ns\n", bitwise_ns, table_ns,
+           frame_ns);
+    (void)sink;
+}
+
+int main(void)
+{
+    test_equivalence();
+    test_frame_check();
+    bench();
+
+    return TEST_RESULT();
+}
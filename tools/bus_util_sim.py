@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Simulate RS-485 bus load of a PLC polling ModbusWithSensorsNoRTOS.
+
+Compares two ways of keeping a copy of registers 40001-40020 up to date:
+
+  full      one FC03 of all 20 registers every scan
+  bitmap    one FC03 of a change bitmap slot (40501/40502) every scan, then
+            one FC03 per run of changed registers; gaps of up to 3 unchanged
+            registers are read through, since that is cheaper than a new frame
+
+The sensors update once per second. Each register changes on an update with
+the probability in CHANGE_P. The table in INTEGRATION_GUIDE.md
+("Change Bitmaps") was produced with the defaults.
+
+  python3 tools/bus_util_sim.py [--baud 9600] [--seconds 3600] [--scan 100 250 500]
+"""
+
+import argparse
+import random
+
+# Chance that a register changes on a 1 s sensor update, 40001-40020
+CHANGE_P = (
+    [1.0] * 4      # 40001-40004 MQ2 raw: ADC noise
+    + [1.0] * 4    # 40005-40008 MQ2 mV: ADC noise
+    + [0.01] * 4   # 40009-40012 MQ2 digital outputs
+    + [0.5] * 3    # 40013-40015 CO2, temperature, humidity
+    + [0.0]        # 40016 SCD30 data ready
+    + [1.0, 1.0]   # 40017-40018 uptime, last update
+    + [0.0, 0.0]   # 40019-40020 control
+)
+REGS = len(CHANGE_P)
+UPDATE_MS = 1000
+FRAME_GAP_CHARS = 3.5
+MAX_READ_THROUGH = 3  # Unchanged registers read rather than starting a new FC03
+
+
+def fc03_ms(count, char_ms):
+    """Request (8 bytes) + reply (5 + 2n bytes) + two inter-frame gaps."""
+    return (8 + 5 + 2 * count + 2 * FRAME_GAP_CHARS) * char_ms
+
+
+def changed_runs(bits):
+    """Register counts of the FC03 reads that cover every set bit."""
+    runs = []
+    start = prev = None
+    for i in range(REGS):
+        if not bits >> i & 1:
+            continue
+        if start is None:
+            start = i
+        elif i - prev - 1 > MAX_READ_THROUGH:
+            runs.append(prev - start + 1)
+            start = i
+        prev = i
+    if start is not None:
+        runs.append(prev - start + 1)
+    return runs
+
+
+def simulate(scan_ms, use_bitmap, char_ms, seconds, ignore=(), seed=1):
+    """Percentage of bus time spent on the polling traffic."""
+    rng = random.Random(seed)
+    ignore_mask = sum(1 << i for i in ignore)
+    busy = 0.0
+    dirty = 0
+    next_update = 0
+    t = 0
+    while t < seconds * 1000:
+        if t >= next_update:
+            for i, p in enumerate(CHANGE_P):
+                if rng.random() < p:
+                    dirty |= 1 << i
+            next_update += UPDATE_MS
+        if use_bitmap:
+            busy += fc03_ms(2, char_ms)
+            busy += sum(fc03_ms(n, char_ms) for n in changed_runs(dirty & ~ignore_mask))
+            dirty = 0
+        else:
+            busy += fc03_ms(REGS, char_ms)
+        t += scan_ms
+    return 100.0 * busy / (seconds * 1000)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--baud", type=int, default=9600, help="line speed, 8N1 (default 9600)")
+    parser.add_argument("--seconds", type=int, default=3600, help="simulated time (default 3600)")
+    parser.add_argument("--scan", type=int, nargs="+", default=[100, 250, 500], help="PLC scan periods in ms")
+    args = parser.parse_args()
+
+    char_ms = 10 * 1000.0 / args.baud
+    print(f"{args.baud} 8N1, {args.seconds} s, sensors updated every {UPDATE_MS} ms")
+    print(f"{'scan':>8}  {'full':>7}  {'bitmap':>7}  {'bitmap, 40017/18 ignored':>24}")
+    for scan in args.scan:
+        full = simulate(scan, False, char_ms, args.seconds)
+        bitmap = simulate(scan, True, char_ms, args.seconds)
+        quiet = simulate(scan, True, char_ms, args.seconds, ignore=(16, 17))
+        print(f"{scan:>5} ms  {full:6.1f}%  {bitmap:6.1f}%  {quiet:23.1f}%")
+
+
+if __name__ == "__main__":
+    main()
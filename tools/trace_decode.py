@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Read and decode the event trace of ModbusWithSensorsNoRTOS.
+
+The firmware logs events into a ring in RAM with DWT cycle timestamps
+(trace.h / trace.c). This tool freezes the ring with coil 00008, reads the
+header (FC20 file 16) and the records (file 17) over Modbus RTU, releases
+the ring and prints a timeline plus latency histograms:
+
+  FRAME_RX -> RESPONSE    request to reply, per function code
+  I2C_START -> I2C_END    SCD30 transfer time, reads and writes
+  id -> same id           inter-arrival time of every event
+
+Requires pyserial for live reads; --load works on a saved dump without it.
+
+  python3 tools/trace_decode.py --port /dev/ttyUSB0 [--slave 1] [--save trace.json]
+  python3 tools/trace_decode.py --load trace.json
+"""
+
+import argparse
+import json
+import math
+import struct
+import sys
+import time
+from collections import defaultdict
+
+# Keep in step with Trace_Event_t in trace.h
+EVENTS = {
+    1: "FRAME_RX",
+    2: "CRC_FAIL",
+    3: "RESPONSE",
+    4: "UART_ERROR",
+    5: "I2C_START",
+    6: "I2C_END",
+    7: "ADC_FRAME",
+    8: "BOOT",
+}
+
+# Keep in step with Boot_Milestone_t in boot.h
+MILESTONES = ["MODBUS_ONLINE", "FIRST_REPLY", "MQ2_READY", "SCD30_READY"]
+
+TRACE_MAGIC = 0x5452
+TRACE_VERSION = 1
+FILE_HEADER = 16
+FILE_RECORDS = 17
+HEADER_REGS = 8
+COIL_FREEZE = 7  # Coil 00008, zero-based address
+CHUNK_REGS = 120  # FC20 reply must fit 245 bytes: 30 events per request
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+
+class ModbusRTU:
+    def __init__(self, port, baud, slave, timeout):
+        import serial  # only needed for live reads
+
+        self.ser = serial.Serial(port, baud, timeout=timeout)
+        self.slave = slave
+        # 3.5 character times of silence between frames
+        self.gap = max(3.5 * 11 / baud, 0.00175)
+
+    def _exchange(self, pdu, reply_len):
+        """Send one request; reply_len(head) gives the reply size from its first 3 bytes"""
+        frame = bytes([self.slave]) + pdu
+        frame += struct.pack("<H", crc16(frame))
+        self.ser.reset_input_buffer()
+        self.ser.write(frame)
+        head = self.ser.read(3)
+        if len(head) < 3:
+            raise IOError("no reply")
+        if head[1] & 0x80:
+            self.ser.read(2)
+            raise IOError("exception %02X on function %02X" % (head[2], head[1] & 0x7F))
+        reply = head + self.ser.read(reply_len(head) - 3)
+        if crc16(reply) != 0:
+            raise IOError("CRC error in reply")
+        time.sleep(self.gap)
+        return reply[1:-2]
+
+    def write_coil(self, addr, on):
+        pdu = struct.pack(">BHH", 0x05, addr, 0xFF00 if on else 0x0000)
+        self._exchange(pdu, lambda head: 8)
+
+    def read_file(self, file, record, count):
+        pdu = struct.pack(">BBBHHH", 0x14, 7, 6, file, record, count)
+        pdu = self._exchange(pdu, lambda head: 3 + head[2] + 2)
+        data = pdu[2:]
+        if data[0] != 1 + 2 * count or data[1] != 6:
+            raise IOError("malformed FC20 reply")
+        return list(struct.unpack(">%dH" % count, data[2:2 + 2 * count]))
+
+
+def dump_device(mb):
+    mb.write_coil(COIL_FREEZE, True)
+    try:
+        hdr = mb.read_file(FILE_HEADER, 0, HEADER_REGS)
+        if hdr[0] != TRACE_MAGIC:
+            raise IOError("no trace on this device (magic %04X)" % hdr[0])
+        if hdr[1] != TRACE_VERSION:
+            raise IOError("trace version %d, decoder knows %d" % (hdr[1], TRACE_VERSION))
+        valid = hdr[5]
+        regs = []
+        while len(regs) < 4 * valid:
+            n = min(CHUNK_REGS, 4 * valid - len(regs))
+            regs += mb.read_file(FILE_RECORDS, len(regs), n)
+    finally:
+        mb.write_coil(COIL_FREEZE, False)
+
+    records = []
+    for i in range(valid):
+        rid, arg, hi, lo = regs[4 * i:4 * i + 4]
+        records.append({"id": rid, "arg": arg, "cycles": (hi << 16) | lo})
+    return {
+        "depth": hdr[2],
+        "count": (hdr[3] << 16) | hdr[4],
+        "clock_khz": hdr[6],
+        "records": records,
+    }
+
+
+def timeline(dump):
+    """Unwrap the 32-bit DWT counter into microseconds from the oldest event"""
+    us_per_cycle = 1000.0 / dump["clock_khz"]
+    t = 0
+    prev = None
+    events = []
+    for r in dump["records"]:
+        if prev is not None:
+            t += (r["cycles"] - prev) & 0xFFFFFFFF
+        prev = r["cycles"]
+        events.append((t * us_per_cycle, r["id"], r["arg"]))
+    return events
+
+
+def describe(eid, arg):
+    if eid == 3:
+        func = arg >> 8
+        text = "FC%02d exception" % (func & 0x7F) if func & 0x80 else "FC%02d" % func
+        return "%s, %d bytes" % (text, arg & 0xFF)
+    if eid == 5:
+        return "%s %d bytes" % ("read" if arg & 0x8000 else "write", arg & 0x7FFF)
+    if eid == 6:
+        return "OK" if arg == 0 else "HAL status %d" % arg
+    if eid == 7:
+        return "burst" if arg else "periodic"
+    if eid == 2:
+        return "FC%02d" % arg
+    if eid == 8:
+        return MILESTONES[arg] if arg < len(MILESTONES) else "milestone %d" % arg
+    return "%d" % arg
+
+
+def histogram(title, samples):
+    if not samples:
+        return
+    samples.sort()
+    print()
+    print("%s: n=%d  min %.1f  median %.1f  max %.1f us" %
+          (title, len(samples), samples[0], samples[len(samples) // 2], samples[-1]))
+    bins = defaultdict(int)
+    for s in samples:
+        bins[int(math.log2(s)) if s >= 1 else 0] += 1
+    width = max(bins.values())
+    for b in range(min(bins), max(bins) + 1):
+        n = bins.get(b, 0)
+        lo = 0 if b == 0 else 2 ** b
+        print("  %8d-%-8d us %5d %s" % (lo, 2 ** (b + 1), n, "#" * (40 * n // width)))
+
+
+def report(dump):
+    events = timeline(dump)
+    print("%d events recorded since boot, %d in the ring (depth %d), clock %d kHz" %
+          (dump["count"], len(events), dump["depth"], dump["clock_khz"]))
+    print()
+    prev_t = None
+    for t, eid, arg in events:
+        dt = "" if prev_t is None else "+%.1f" % (t - prev_t)
+        print("%12.1f us %10s  %-10s %s" % (t, dt, EVENTS.get(eid, "EV%d" % eid), describe(eid, arg)))
+        prev_t = t
+
+    pairs = defaultdict(list)
+    last = {}
+    seen = {}
+    inter = defaultdict(list)
+    for t, eid, arg in events:
+        if eid in seen:
+            inter[eid].append(t - seen[eid])
+        seen[eid] = t
+        if eid == 3 and 1 in last:
+            pairs["FRAME_RX -> RESPONSE FC%02d" % ((arg >> 8) & 0x7F)].append(t - last[1][0])
+            del last[1]
+        if eid == 6 and 5 in last:
+            kind = "read" if last[5][1] & 0x8000 else "write"
+            pairs["I2C_START -> I2C_END " + kind].append(t - last[5][0])
+            del last[5]
+        if eid not in (3, 6):
+            last[eid] = (t, arg)
+
+    for name in sorted(pairs):
+        histogram(name, pairs[name])
+    for eid in sorted(inter):
+        histogram("%s inter-arrival" % EVENTS.get(eid, "EV%d" % eid), inter[eid])
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--port", help="serial port of the RS485 adapter")
+    ap.add_argument("--baud", type=int, default=9600)
+    ap.add_argument("--slave", type=int, default=1)
+    ap.add_argument("--timeout", type=float, default=1.0)
+    ap.add_argument("--save", help="write the raw dump as JSON")
+    ap.add_argument("--load", help="decode a saved dump instead of reading the device")
+    args = ap.parse_args()
+
+    if args.load:
+        with open(args.load) as f:
+            dump = json.load(f)
+    elif args.port:
+        dump = dump_device(ModbusRTU(args.port, args.baud, args.slave, args.timeout))
+    else:
+        ap.error("--port or --load is required")
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(dump, f, indent=1)
+    report(dump)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())